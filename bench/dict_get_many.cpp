@@ -0,0 +1,65 @@
+// Dict 批量查找基准：随机顺序查找全部键，对比逐个 get 与 get_many（每批预取起始槽位）。
+// 默认 400 万个键，表的大小远超常见的末级缓存，查找以缓存未命中为主。
+// 构建：cmake -DKS_BUILD_BENCHMARKS=ON，运行 ./dict_get_many [键数] [轮数]
+
+#include "src/dict.hpp"
+#include "src/print.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace ks;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template<typename Call>
+auto time_ms(Call&& call) -> double {
+    auto start = Clock::now();
+    call();
+    auto end = Clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+    std::size_t count = argc > 1 ? (std::size_t)std::atoll(argv[1]) : 4000000;
+    int rounds = argc > 2 ? std::atoi(argv[2]) : 3;
+
+    std::vector<String> keys;
+    keys.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        keys.push_back(format_to_string(KS_FMT("user:{:08x}:profile"), i * 2654435761u));
+    }
+    Dict<std::size_t> dict;
+    dict.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) dict.insert(keys[i], i);
+
+    // 打乱查找顺序，避免相邻键落在相邻槽位
+    std::vector<String> queries(keys);
+    std::shuffle(queries.begin(), queries.end(), std::mt19937_64(42));
+    std::vector<const std::size_t*> out(count);
+    println(KS_FMT("{} keys, {} rounds"), count, rounds);
+
+    for (int round = 0; round < rounds; ++round) {
+        std::size_t sum_single = 0;
+        double single = time_ms([&] {
+            for (const auto& key : queries) sum_single += dict.get(key, 0);
+        });
+        std::size_t sum_batch = 0;
+        double batch = time_ms([&] {
+            dict.get_many(queries.data(), queries.size(), out.data());
+            for (const auto* value : out) sum_batch += *value;
+        });
+        if (sum_single != sum_batch) {
+            println("checksum mismatch");
+            return 1;
+        }
+        println(KS_FMT("get {:>9.1f} ms   get_many {:>9.1f} ms   speedup {:.2f}x"), single, batch, single / batch);
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+// 日志调用延迟基准：逐次测量每次调用的耗时，输出 p50 / p99 / p99.9（纳秒）。
+// 对比异步 Logger 与直接 println 到 Sink（同步格式化和 write(2)），输出写到 /dev/null。
+// 构建：cmake -DKS_BUILD_BENCHMARKS=ON，运行 ./logger_latency [次数] [线程数]
+
+#include "src/logger.hpp"
+#include "src/print.hpp"
+#include "src/sink.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace ks;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template<typename Call>
+auto measure(int count, Call&& call) -> std::vector<std::int64_t> {
+    std::vector<std::int64_t> samples;
+    samples.reserve((std::size_t)count);
+    for (int i = 0; i < count; ++i) {
+        auto start = Clock::now();
+        call(i);
+        auto end = Clock::now();
+        samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+    return samples;
+}
+
+/// threads 个线程同时调用，合并所有样本
+template<typename Call>
+auto measure_threads(int count, int threads, Call&& call) -> std::vector<std::int64_t> {
+    std::vector<std::vector<std::int64_t>> parts((std::size_t)threads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] { parts[(std::size_t)t] = measure(count, call); });
+    }
+    for (auto& worker : workers) worker.join();
+    std::vector<std::int64_t> samples;
+    for (auto& part : parts) samples.insert(samples.end(), part.begin(), part.end());
+    return samples;
+}
+
+auto report(const char* name, std::vector<std::int64_t> samples) -> void {
+    std::sort(samples.begin(), samples.end());
+    auto at = [&](double q) { return samples[(std::size_t)(q * (double)(samples.size() - 1))]; };
+    println(KS_FMT("{:<24} p50 {:>7} ns   p99 {:>7} ns   p99.9 {:>8} ns"), name, at(0.5), at(0.99), at(0.999));
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+    int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int threads = argc > 2 ? std::atoi(argv[2]) : 1;
+    auto null_sink = Sink::open("/dev/null", true, FlushPolicy::Full);
+    if (null_sink.is_err()) {
+        println("cannot open /dev/null");
+        return 1;
+    }
+    Sink& sink = null_sink.value();
+    println(KS_FMT("{} calls x {} threads"), count, threads);
+    // 两次读时钟本身的开销，各项结果都包含它
+    report("(clock overhead)", measure_threads(count, threads, [](int) {}));
+
+    {
+        LoggerOptions options;
+        options.capacity = 64 << 20;  // 足够大，测量时不丢弃
+        Logger logger(sink, options);
+        report("Logger::info", measure_threads(count, threads, [&](int i) {
+            logger.info(KS_FMT("request {} from {} took {:.3f} ms"), i, "10.0.0.1", i * 0.001);
+        }));
+        if (logger.dropped() != 0) println("dropped {}", logger.dropped());
+    }
+    report("println(sink)", measure_threads(count, threads, [&](int i) {
+        println(sink, KS_FMT("INFO request {} from {} took {:.3f} ms"), i, "10.0.0.1", i * 0.001);
+    }));
+    return 0;
+}
@@ -0,0 +1,111 @@
+// String 表示基准：100 万个 15~25 字节的键上测量构造拷贝、len()/c_str()、upper()、
+// Dict 插入查找和 split。23 字节以内的 String 内联存放，不分配堆内存。
+// 只使用内联表示之前就有的接口（输出也不用 KS_FMT），同一文件可以对照旧版本的 String 编译运行；
+// 另外给出相同操作下 std::string 的耗时作为参照。
+// 构建：cmake -DKS_BUILD_BENCHMARKS=ON，运行 ./string_sso [键数] [轮数]
+
+#include "src/dict.hpp"
+#include "src/string.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace ks;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template<typename Call>
+auto time_ms(Call&& call) -> double {
+    auto start = Clock::now();
+    call();
+    auto end = Clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/// 防止结果被优化掉
+volatile std::size_t sink_value;
+
+template<typename S>
+auto construct_copy(const std::vector<std::string>& source) -> double {
+    return time_ms([&] {
+        std::vector<S> strings;
+        strings.reserve(source.size());
+        for (const auto& text : source) strings.emplace_back(text.c_str());
+        std::vector<S> copies(strings);
+        sink_value = copies.size();
+    });
+}
+
+template<typename S>
+auto len_c_str(const std::vector<S>& strings, int repeat) -> double {
+    return time_ms([&] {
+        std::size_t total = 0;
+        for (int r = 0; r < repeat; ++r) {
+            for (const auto& s : strings) {
+                if constexpr (std::is_same_v<S, std::string>) {
+                    total += s.size() + (std::size_t)s.c_str()[0];
+                } else {
+                    total += s.len() + (std::size_t)s.c_str()[0];
+                }
+            }
+        }
+        sink_value = total;
+    });
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+    std::size_t count = argc > 1 ? (std::size_t)std::atoll(argv[1]) : 1000000;
+    int rounds = argc > 2 ? std::atoi(argv[2]) : 3;
+
+    std::mt19937_64 rng(42);
+    std::vector<std::string> source;
+    source.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string text = "key_" + std::to_string(rng());
+        text.resize(15 + rng() % 11, 'x');
+        source.push_back(text);
+    }
+    std::vector<String> strings;
+    std::vector<std::string> std_strings(source);
+    for (const auto& text : source) strings.push_back(String(text));
+    std::vector<String> lookups;
+    for (std::size_t i = 0; i < count; ++i) lookups.push_back(strings[rng() % count]);
+    std::string joined;
+    for (std::size_t i = 0; i < 2000; ++i) joined += source[i % count] + ",";
+    String csv(joined);
+
+    std::printf("%zu keys of 15-25 bytes, %d rounds (ms)\n", count, rounds);
+    for (int round = 0; round < rounds; ++round) {
+        std::printf("round %d\n", round);
+        std::printf("  construct + copy       String %8.1f   std::string %8.1f\n",
+                    construct_copy<String>(source), construct_copy<std::string>(source));
+        std::printf("  len()/c_str() x50      String %8.1f   std::string %8.1f\n",
+                    len_c_str(strings, 50), len_c_str(std_strings, 50));
+        std::printf("  upper()                String %8.1f\n", time_ms([&] {
+            std::size_t total = 0;
+            for (const auto& s : strings) total += s.upper().len();
+            sink_value = total;
+        }));
+        std::printf("  Dict insert 1/5 + get  String %8.1f\n", time_ms([&] {
+            Dict<std::size_t> dict;
+            for (std::size_t i = 0; i < count / 5; ++i) dict.insert(strings[i], i);
+            std::size_t total = 0;
+            for (const auto& key : lookups) total += dict.get(key, 0);
+            sink_value = total;
+        }));
+        std::printf("  split 2000 fields x500 String %8.1f\n", time_ms([&] {
+            std::size_t total = 0;
+            for (int r = 0; r < 500; ++r) total += csv.split(",").size();
+            sink_value = total;
+        }));
+    }
+    return 0;
+}
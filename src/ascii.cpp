@@ -0,0 +1,273 @@
+#include "ascii.hpp"
+#include "bits.hpp"
+
+#if !defined(KS_DISABLE_SIMD) && (defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__)))
+    #define KS_ASCII_SSE2 1
+    #include <emmintrin.h>
+    // AVX2 内核通过函数级 target 属性单独编译，不要求整个项目开启 -mavx2
+    #if defined(__GNUC__)
+        #define KS_ASCII_AVX2 1
+        #define KS_TARGET_AVX2 __attribute__((target("avx2")))
+        #include <immintrin.h>
+    #endif
+#endif
+
+namespace ks {
+namespace detail {
+
+namespace {
+
+// ==================== 标量实现 ====================
+
+inline auto in_range(unsigned char c, unsigned char lo, unsigned char hi) -> bool {
+    return (unsigned char)(c - lo) <= (unsigned char)(hi - lo);
+}
+
+inline auto byte_in_class(unsigned char c, CharClass cls) -> bool {
+    switch (cls) {
+        case CharClass::Alpha: return in_range(c | 0x20, 'a', 'z');
+        case CharClass::Digit: return in_range(c, '0', '9');
+        case CharClass::Alnum: return in_range(c | 0x20, 'a', 'z') || in_range(c, '0', '9');
+        case CharClass::Space: return c == ' ' || in_range(c, '\t', '\r');
+    }
+    return false;
+}
+
+inline auto byte_case(unsigned char c) -> unsigned {
+    if (in_range(c, 'a', 'z')) return CASE_HAS_LOWER;
+    if (in_range(c, 'A', 'Z')) return CASE_HAS_UPPER;
+    return 0;
+}
+
+inline auto byte_convert(unsigned char c, CaseOp op) -> char {
+    bool lower = in_range(c, 'a', 'z');
+    bool upper = in_range(c, 'A', 'Z');
+    switch (op) {
+        case CaseOp::Lower: return (char)(upper ? c | 0x20 : c);
+        case CaseOp::Upper: return (char)(lower ? c & ~0x20 : c);
+        case CaseOp::Swap: return (char)((lower || upper) ? c ^ 0x20 : c);
+    }
+    return (char)c;
+}
+
+auto scalar_span_of_class(const char* data, std::size_t len, CharClass cls) -> std::size_t {
+    for (std::size_t i = 0; i < len; ++i) {
+        auto c = (unsigned char)data[i];
+        if (c >= 0x80 || !byte_in_class(c, cls)) return i;
+    }
+    return len;
+}
+
+auto scalar_scan_case(const char* data, std::size_t len, unsigned& flags) -> std::size_t {
+    for (std::size_t i = 0; i < len; ++i) {
+        auto c = (unsigned char)data[i];
+        if (c >= 0x80) return i;
+        flags |= byte_case(c);
+    }
+    return len;
+}
+
+auto scalar_convert_case(const char* src, char* dst, std::size_t len, CaseOp op) -> std::size_t {
+    for (std::size_t i = 0; i < len; ++i) {
+        auto c = (unsigned char)src[i];
+        if (c >= 0x80) return i;
+        dst[i] = byte_convert(c, op);
+    }
+    return len;
+}
+
+/// 块内第一个非 ASCII 字节之前的位掩码
+inline auto ascii_prefix_mask(unsigned non_ascii) -> unsigned {
+    return non_ascii == 0 ? ~0u : (non_ascii & (0u - non_ascii)) - 1;
+}
+
+#ifdef KS_ASCII_SSE2
+
+// ==================== SSE2 实现 ====================
+// 非 ASCII 字节（最高位为 1）作为有符号数是负数，不会落在任何 ASCII 范围内
+
+inline auto sse2_range(__m128i v, char lo, char hi) -> __m128i {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)(lo - 1))),
+                         _mm_cmplt_epi8(v, _mm_set1_epi8((char)(hi + 1))));
+}
+
+inline auto sse2_alpha(__m128i v) -> __m128i {
+    // 0x80..0xFF 或上 0x20 后仍为负数
+    return sse2_range(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z');
+}
+
+inline auto sse2_class(__m128i v, CharClass cls) -> __m128i {
+    switch (cls) {
+        case CharClass::Alpha: return sse2_alpha(v);
+        case CharClass::Digit: return sse2_range(v, '0', '9');
+        case CharClass::Alnum: return _mm_or_si128(sse2_alpha(v), sse2_range(v, '0', '9'));
+        case CharClass::Space:
+            return _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), sse2_range(v, '\t', '\r'));
+    }
+    return _mm_setzero_si128();
+}
+
+auto sse2_span_of_class(const char* data, std::size_t len, CharClass cls) -> std::size_t {
+    std::size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+        unsigned mask = (unsigned)_mm_movemask_epi8(sse2_class(v, cls));
+        if (mask != 0xFFFF) return i + (std::size_t)lowest_bit(~mask);
+    }
+    return i + scalar_span_of_class(data + i, len - i, cls);
+}
+
+auto sse2_scan_case(const char* data, std::size_t len, unsigned& flags) -> std::size_t {
+    std::size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+        unsigned non_ascii = (unsigned)_mm_movemask_epi8(v);
+        unsigned keep = ascii_prefix_mask(non_ascii);
+        if ((unsigned)_mm_movemask_epi8(sse2_range(v, 'a', 'z')) & keep) flags |= CASE_HAS_LOWER;
+        if ((unsigned)_mm_movemask_epi8(sse2_range(v, 'A', 'Z')) & keep) flags |= CASE_HAS_UPPER;
+        if (non_ascii != 0) return i + (std::size_t)lowest_bit(non_ascii);
+        if (flags == (CASE_HAS_LOWER | CASE_HAS_UPPER)) return i + 16;
+    }
+    return i + scalar_scan_case(data + i, len - i, flags);
+}
+
+auto sse2_convert_case(const char* src, char* dst, std::size_t len, CaseOp op) -> std::size_t {
+    const __m128i bit = _mm_set1_epi8(0x20);
+    std::size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        if (_mm_movemask_epi8(v) != 0) break;
+        // 需要翻转的字母的 0x20 位
+        __m128i flip;
+        switch (op) {
+            case CaseOp::Lower: flip = sse2_range(v, 'A', 'Z'); break;
+            case CaseOp::Upper: flip = sse2_range(v, 'a', 'z'); break;
+            default: flip = sse2_alpha(v); break;
+        }
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_xor_si128(v, _mm_and_si128(flip, bit)));
+    }
+    return i + scalar_convert_case(src + i, dst + i, len - i, op);
+}
+
+#endif
+
+#ifdef KS_ASCII_AVX2
+
+// ==================== AVX2 实现 ====================
+// 尾部交给 SSE2 版本前先清空 YMM 高位，避免 AVX 与传统 SSE 指令切换的停顿
+
+KS_TARGET_AVX2 inline auto avx2_range(__m256i v, char lo, char hi) -> __m256i {
+    return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8((char)(lo - 1))),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(hi + 1)), v));
+}
+
+KS_TARGET_AVX2 inline auto avx2_alpha(__m256i v) -> __m256i {
+    return avx2_range(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z');
+}
+
+KS_TARGET_AVX2 inline auto avx2_class(__m256i v, CharClass cls) -> __m256i {
+    switch (cls) {
+        case CharClass::Alpha: return avx2_alpha(v);
+        case CharClass::Digit: return avx2_range(v, '0', '9');
+        case CharClass::Alnum: return _mm256_or_si256(avx2_alpha(v), avx2_range(v, '0', '9'));
+        case CharClass::Space:
+            return _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), avx2_range(v, '\t', '\r'));
+    }
+    return _mm256_setzero_si256();
+}
+
+KS_TARGET_AVX2 auto avx2_span_of_class(const char* data, std::size_t len, CharClass cls) -> std::size_t {
+    std::size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(avx2_class(v, cls));
+        if (mask != 0xFFFFFFFFu) return i + (std::size_t)lowest_bit(~mask);
+    }
+    _mm256_zeroupper();
+    return i + sse2_span_of_class(data + i, len - i, cls);
+}
+
+KS_TARGET_AVX2 auto avx2_scan_case(const char* data, std::size_t len, unsigned& flags) -> std::size_t {
+    std::size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+        unsigned non_ascii = (unsigned)_mm256_movemask_epi8(v);
+        unsigned keep = ascii_prefix_mask(non_ascii);
+        if ((unsigned)_mm256_movemask_epi8(avx2_range(v, 'a', 'z')) & keep) flags |= CASE_HAS_LOWER;
+        if ((unsigned)_mm256_movemask_epi8(avx2_range(v, 'A', 'Z')) & keep) flags |= CASE_HAS_UPPER;
+        if (non_ascii != 0) return i + (std::size_t)lowest_bit(non_ascii);
+        if (flags == (CASE_HAS_LOWER | CASE_HAS_UPPER)) return i + 32;
+    }
+    _mm256_zeroupper();
+    return i + sse2_scan_case(data + i, len - i, flags);
+}
+
+KS_TARGET_AVX2 auto avx2_convert_case(const char* src, char* dst, std::size_t len, CaseOp op) -> std::size_t {
+    const __m256i bit = _mm256_set1_epi8(0x20);
+    std::size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        if (_mm256_movemask_epi8(v) != 0) break;
+        __m256i flip;
+        switch (op) {
+            case CaseOp::Lower: flip = avx2_range(v, 'A', 'Z'); break;
+            case CaseOp::Upper: flip = avx2_range(v, 'a', 'z'); break;
+            default: flip = avx2_alpha(v); break;
+        }
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_xor_si256(v, _mm256_and_si256(flip, bit)));
+    }
+    _mm256_zeroupper();
+    return i + sse2_convert_case(src + i, dst + i, len - i, op);
+}
+
+#endif
+
+// ==================== 运行时分派 ====================
+
+struct AsciiKernels {
+    std::size_t (*span_of_class)(const char*, std::size_t, CharClass);
+    std::size_t (*scan_case)(const char*, std::size_t, unsigned&);
+    std::size_t (*convert_case)(const char*, char*, std::size_t, CaseOp);
+};
+
+auto select_kernels() -> AsciiKernels {
+#ifdef KS_ASCII_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return {avx2_span_of_class, avx2_scan_case, avx2_convert_case};
+    }
+#endif
+#ifdef KS_ASCII_SSE2
+    return {sse2_span_of_class, sse2_scan_case, sse2_convert_case};
+#else
+    return {scalar_span_of_class, scalar_scan_case, scalar_convert_case};
+#endif
+}
+
+auto kernels() -> const AsciiKernels& {
+    static const AsciiKernels selected = select_kernels();
+    return selected;
+}
+
+/// 短于一个向量块的输入直接走标量路径，省去分派开销
+constexpr std::size_t SIMD_MIN_LEN = 16;
+
+} // namespace
+
+auto ascii_span_of_class(const char* data, std::size_t len, CharClass cls) -> std::size_t {
+    if (len < SIMD_MIN_LEN) return scalar_span_of_class(data, len, cls);
+    return kernels().span_of_class(data, len, cls);
+}
+
+auto ascii_scan_case(const char* data, std::size_t len, unsigned& flags) -> std::size_t {
+    if (len < SIMD_MIN_LEN) return scalar_scan_case(data, len, flags);
+    return kernels().scan_case(data, len, flags);
+}
+
+auto ascii_convert_case(const char* src, char* dst, std::size_t len, CaseOp op) -> std::size_t {
+    if (len < SIMD_MIN_LEN) return scalar_convert_case(src, dst, len, op);
+    return kernels().convert_case(src, dst, len, op);
+}
+
+} // namespace detail
+} // namespace ks
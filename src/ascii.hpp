@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ks {
+namespace detail {
+
+/// 字符类别，对应 std::isalpha / std::isdigit / std::isalnum / std::isspace
+enum class CharClass { Alpha, Digit, Alnum, Space };
+
+/// 大小写转换方式
+enum class CaseOp { Lower, Upper, Swap };
+
+/// scan_case 的结果标志位
+constexpr unsigned CASE_HAS_LOWER = 1;
+constexpr unsigned CASE_HAS_UPPER = 2;
+
+// 以下函数按块（16 或 32 字节）处理开头连续的 ASCII 字节，遇到第一个非 ASCII 字节时停止并返回其位置，
+// 非 ASCII 部分由 unicode.cpp 按码点查表处理。ASCII 字节按 C locale 的规则分类和转换，与进程 locale 无关。
+// 运行时根据 CPU 支持选择 AVX2 / SSE2 / 标量实现；定义 KS_DISABLE_SIMD 时只使用标量实现。
+
+/// 开头连续属于指定类别的 ASCII 字节个数，遇到非 ASCII 字节或不属于该类别的字节时停止
+auto ascii_span_of_class(const char* data, std::size_t len, CharClass cls) -> std::size_t;
+
+/// 扫描开头连续的 ASCII 字节中字母的大小写，结果并入 flags，返回扫描过的字节数；
+/// 两种大小写都出现后可以提前返回
+auto ascii_scan_case(const char* data, std::size_t len, unsigned& flags) -> std::size_t;
+
+/// 把开头连续的 ASCII 字节按 op 转换后写入 dst，返回转换的字节数；dst 可以与 src 相同
+auto ascii_convert_case(const char* src, char* dst, std::size_t len, CaseOp op) -> std::size_t;
+
+/// 256 位的字节集合，用于 strip 等按字符集合扫描的操作，查询为 O(1) 且不分配内存
+class ByteSet {
+    std::uint64_t bits_[4];
+
+public:
+    constexpr ByteSet() : bits_{0, 0, 0, 0} {}
+    constexpr explicit ByteSet(std::string_view chars) : bits_{0, 0, 0, 0} {
+        for (char c : chars) add(c);
+    }
+
+    constexpr auto add(char c) -> void {
+        auto b = (unsigned char)c;
+        bits_[b >> 6] |= (std::uint64_t)1 << (b & 63);
+    }
+
+    constexpr auto contains(char c) const -> bool {
+        auto b = (unsigned char)c;
+        return (bits_[b >> 6] >> (b & 63)) & 1;
+    }
+
+    /// 从左边开始第一个不在集合中的字节位置
+    auto span_left(const char* data, std::size_t len) const -> std::size_t {
+        std::size_t start = 0;
+        while (start < len && contains(data[start])) ++start;
+        return start;
+    }
+
+    /// 从右边开始第一个不在集合中的字节之后的位置，不小于 start
+    auto span_right(const char* data, std::size_t start, std::size_t len) const -> std::size_t {
+        std::size_t end = len;
+        while (end > start && contains(data[end - 1])) --end;
+        return end;
+    }
+};
+
+/// strip() 默认去除的空白字符：" \t\n\r\f\v"
+inline constexpr ByteSet WHITESPACE_SET(" \t\n\r\f\v");
+
+} // namespace detail
+} // namespace ks
@@ -0,0 +1,116 @@
+#include "atom.hpp"
+
+namespace ks {
+
+namespace {
+
+/// 与 Dict 使用的 detail::hash_string 相同，Atom 与 String 键可以混用
+auto hash_text(std::string_view text) -> std::size_t {
+    return std::hash<std::string_view>{}(text);
+}
+
+/// 所有驻留表共享的空串，默认构造的 Atom 指向它。
+/// 用函数内静态变量：其他翻译单元的静态初始化中构造的 Atom 也能看到初始化完成的条目；
+/// 与 Interner::global 一样故意泄漏，静态对象析构期间仍可使用
+auto empty_entry() -> const detail::AtomEntry* {
+    static const detail::AtomEntry* entry = new detail::AtomEntry{hash_text(std::string_view()), String()};
+    return entry;
+}
+
+} // namespace
+
+// ==================== Atom ====================
+
+Atom::Atom() : entry_(empty_entry()) {}
+
+auto Atom::intern(StringView text) -> Atom {
+    return Interner::global().intern(text);
+}
+
+// ==================== Interner ====================
+
+Interner::Table::Table(SizeType capacity)
+    : mask(capacity - 1), slots(new std::atomic<const detail::AtomEntry*>[capacity]) {
+    for (SizeType i = 0; i < capacity; ++i) {
+        slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+Interner::Interner() : size_(0) {
+    tables_.push_back(std::make_unique<Table>(INITIAL_CAPACITY));
+    table_.store(tables_.back().get(), std::memory_order_release);
+}
+
+Interner::~Interner() = default;
+
+auto Interner::global() -> Interner& {
+    // 故意泄漏：保证静态对象析构期间仍可使用全局 Atom
+    static Interner* instance = new Interner();
+    return *instance;
+}
+
+auto Interner::find_in(const Table* table, std::string_view text, std::size_t hash) -> const detail::AtomEntry* {
+    // 只插入不删除，遇到空槽位即可确定不存在
+    for (SizeType index = hash & table->mask;; index = (index + 1) & table->mask) {
+        const detail::AtomEntry* entry = table->slots[index].load(std::memory_order_acquire);
+        if (entry == nullptr) return nullptr;
+        if (entry->hash == hash && entry->text.view() == text) return entry;
+    }
+}
+
+auto Interner::lookup(StringView text) const -> std::optional<Atom> {
+    if (text.empty()) return Atom();
+    auto* entry = find_in(table_.load(std::memory_order_acquire), text.view(), hash_text(text.view()));
+    if (entry == nullptr) return std::nullopt;
+    return Atom(entry);
+}
+
+auto Interner::intern(StringView text) -> Atom {
+    if (text.empty()) return Atom();
+    std::size_t hash = hash_text(text.view());
+    // 快速路径：无锁查找
+    if (auto* entry = find_in(table_.load(std::memory_order_acquire), text.view(), hash)) {
+        return Atom(entry);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 加锁后重新查找：其他线程可能刚刚插入了同样的字符串
+    Table* table = table_.load(std::memory_order_relaxed);
+    if (auto* entry = find_in(table, text.view(), hash)) {
+        return Atom(entry);
+    }
+    // 负载因子保持在 1/2 以下，探测链较短，也保证表中总有空槽位
+    if ((size_.load(std::memory_order_relaxed) + 1) * 2 > table->mask + 1) {
+        grow();
+        table = table_.load(std::memory_order_relaxed);
+    }
+    entries_.push_back(detail::AtomEntry{hash, text.to_string()});
+    const detail::AtomEntry* entry = &entries_.back();
+    SizeType index = hash & table->mask;
+    while (table->slots[index].load(std::memory_order_relaxed) != nullptr) {
+        index = (index + 1) & table->mask;
+    }
+    // release 保证读者看到指针时条目已经构造完毕
+    table->slots[index].store(entry, std::memory_order_release);
+    size_.fetch_add(1, std::memory_order_relaxed);
+    return Atom(entry);
+}
+
+auto Interner::grow() -> void {
+    const Table* old = table_.load(std::memory_order_relaxed);
+    auto table = std::make_unique<Table>((old->mask + 1) * 2);
+    for (SizeType i = 0; i <= old->mask; ++i) {
+        const detail::AtomEntry* entry = old->slots[i].load(std::memory_order_relaxed);
+        if (entry == nullptr) continue;
+        SizeType index = entry->hash & table->mask;
+        while (table->slots[index].load(std::memory_order_relaxed) != nullptr) {
+            index = (index + 1) & table->mask;
+        }
+        table->slots[index].store(entry, std::memory_order_relaxed);
+    }
+    // 新表填好后再发布；旧表继续保留，正在读旧表的线程不受影响
+    table_.store(table.get(), std::memory_order_release);
+    tables_.push_back(std::move(table));
+}
+
+} // namespace ks
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "string.hpp"
+#include "string_view.hpp"
+
+namespace ks {
+
+class Interner;
+
+namespace detail {
+
+/// 驻留表中的一项：文本与预先计算好的哈希值，地址在所属驻留表销毁前保持不变
+struct AtomEntry {
+    std::size_t hash;
+    String text;
+};
+
+} // namespace detail
+
+/// 驻留字符串句柄，只有一个指针大小。
+/// 同一驻留表中文本相同的 Atom 指向同一项，因此比较只需比较指针，哈希值在驻留时已算好。
+/// 哈希值与 Dict 对同样文本计算的哈希值相同，可以直接作为 Dict 的键使用。
+/// 不同驻留表得到的 Atom 即使文本相同也不相等（空串除外，所有驻留表共享同一个空串）
+class Atom {
+    const detail::AtomEntry* entry_;
+
+    explicit Atom(const detail::AtomEntry* entry) : entry_(entry) {}
+    friend class Interner;
+
+public:
+    using SizeType = std::size_t;
+
+    /// 空串
+    Atom();
+
+    /// 在全局驻留表中驻留 text
+    static auto intern(StringView text) -> Atom;
+
+    // 访问器
+    auto str() const -> const String& { return entry_->text; }
+    auto view() const -> std::string_view { return entry_->text.view(); }
+    auto c_str() const -> const char* { return entry_->text.c_str(); }
+    auto len() const -> SizeType { return entry_->text.len(); }
+    auto empty() const -> bool { return entry_->text.empty(); }
+    auto hash() const -> std::size_t { return entry_->hash; }
+
+    /// 可以在需要 const String& 的地方直接使用
+    operator const String&() const { return entry_->text; }
+
+    // 比较：相等性只比较指针；大小按文本比较，保证顺序与驻留先后无关
+    auto operator==(const Atom& other) const -> bool { return entry_ == other.entry_; }
+    auto operator!=(const Atom& other) const -> bool { return entry_ != other.entry_; }
+    auto operator<(const Atom& other) const -> bool { return view() < other.view(); }
+};
+
+/// 字符串驻留表：查找路径无锁，只有插入新字符串时才加锁。
+/// 槽位数组为开放地址表，扩容时发布新表，旧表保留到驻留表销毁，
+/// 因此并发读者拿到的表指针始终有效。驻留表销毁后，从它得到的 Atom 全部失效
+class Interner {
+public:
+    using SizeType = std::size_t;
+
+    Interner();
+    ~Interner();
+
+    Interner(const Interner&) = delete;
+    auto operator=(const Interner&) -> Interner& = delete;
+
+    /// 返回 text 对应的 Atom，不存在时驻留一份拷贝
+    auto intern(StringView text) -> Atom;
+
+    /// 只查找不驻留，不存在时返回空
+    auto lookup(StringView text) const -> std::optional<Atom>;
+
+    /// 已驻留的字符串数量（不含空串）
+    auto size() const -> SizeType { return size_.load(std::memory_order_relaxed); }
+
+    /// 进程级的全局驻留表，永不销毁
+    static auto global() -> Interner&;
+
+private:
+    struct Table {
+        SizeType mask;
+        std::unique_ptr<std::atomic<const detail::AtomEntry*>[]> slots;
+
+        explicit Table(SizeType capacity);
+    };
+
+    std::atomic<Table*> table_;
+    std::vector<std::unique_ptr<Table>> tables_;  // 所有发布过的表，只在加锁时修改
+    std::deque<detail::AtomEntry> entries_;       // deque 追加时不移动已有元素
+    std::atomic<SizeType> size_;
+    std::mutex mutex_;
+
+    static constexpr SizeType INITIAL_CAPACITY = 64;
+
+    static auto find_in(const Table* table, std::string_view text, std::size_t hash) -> const detail::AtomEntry*;
+    auto grow() -> void;
+};
+
+} // namespace ks
+
+namespace std {
+
+template<>
+struct hash<ks::Atom> {
+    auto operator()(const ks::Atom& atom) const noexcept -> std::size_t { return atom.hash(); }
+};
+
+} // namespace std
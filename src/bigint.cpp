@@ -1,4 +1,5 @@
 #include "bigint.hpp"
+#include "charconv.hpp"
 #include <cctype>
 #include <limits>
 #include <stdexcept>  // 仅用于辅助，不使用异常
@@ -473,15 +474,17 @@ auto BigInt::to_string() const -> std::string {
     if (is_zero()) return "0";
     std::string s;
     if (negative_) s.push_back('-');
+    s.reserve(data_.size() * DIGIT_BITS + 1);
     // 最高位（最高 digit）需要完整输出，不需要前导零
-    s += std::to_string(data_.back());
+    char part[INT_CHARS_MAX];
+    s.append(part, (size_t)(format_uint(data_.back(), part) - part));
     for (size_t i = data_.size() - 1; i-- > 0; ) {
-        std::string part = std::to_string(data_[i]);
+        size_t n = (size_t)(format_uint(data_[i], part) - part);
         // 前面补零到9位
-        if (part.size() < DIGIT_BITS) {
-            s.append(DIGIT_BITS - part.size(), '0');
+        if (n < DIGIT_BITS) {
+            s.append(DIGIT_BITS - n, '0');
         }
-        s += part;
+        s.append(part, n);
     }
     return s;
 }
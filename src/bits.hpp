@@ -0,0 +1,47 @@
+#pragma once
+
+// SIMD 内核共用的位操作：GCC / Clang 使用内建函数，MSVC 使用对应的内部函数
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+namespace ks {
+namespace detail {
+
+/// 最低位的 1 所在的下标，mask 不能为 0
+inline auto lowest_bit(unsigned mask) -> unsigned {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (unsigned)index;
+#else
+    return (unsigned)__builtin_ctz(mask);
+#endif
+}
+
+/// 最高位的 1 所在的下标，mask 不能为 0
+inline auto highest_bit(unsigned mask) -> unsigned {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse(&index, mask);
+    return (unsigned)index;
+#else
+    return 31u - (unsigned)__builtin_clz(mask);
+#endif
+}
+
+/// 1 的个数。MSVC 的 __popcnt 要求 CPU 支持 POPCNT 指令（不属于 SSE2 基线），改用移位相加
+inline auto popcount(unsigned mask) -> unsigned {
+#ifdef _MSC_VER
+    mask = mask - ((mask >> 1) & 0x55555555u);
+    mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+    mask = (mask + (mask >> 4)) & 0x0F0F0F0Fu;
+    return (mask * 0x01010101u) >> 24;
+#else
+    return (unsigned)__builtin_popcount(mask);
+#endif
+}
+
+} // namespace detail
+} // namespace ks
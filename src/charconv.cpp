@@ -0,0 +1,1047 @@
+#include "charconv.hpp"
+#include "ascii.hpp"
+#include <cstring>
+#include <limits>
+
+namespace ks {
+
+namespace detail {
+
+/// 5^q 的 128 位近似值，q 属于 [-342, 308]，定义在 pow5_table.cpp
+extern const std::uint64_t POW5_128[];
+
+/// 10^k 的 128 位上界近似值，k 属于 [-292, 326]，定义在 pow5_table.cpp
+extern const std::uint64_t POW10_128[];
+
+} // namespace detail
+
+namespace {
+
+// ==================== 整数 ====================
+
+inline auto is_digit(char c) -> bool {
+    return (unsigned char)(c - '0') <= 9;
+}
+
+inline auto load8(const char* p) -> std::uint64_t {
+    std::uint64_t v;
+    std::memcpy(&v, p, 8);
+    return v;
+}
+
+/// 8 个字节是否都是 '0'..'9'（小端序读入）
+inline auto is_eight_digits(std::uint64_t v) -> bool {
+    return ((v & 0xF0F0F0F0F0F0F0F0ull) | (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+           == 0x3333333333333333ull;
+}
+
+/// 把 8 个数字字符转换为整数：相邻两位、四位、八位依次合并，共 3 次乘法
+inline auto parse_eight_digits(std::uint64_t v) -> std::uint32_t {
+    v -= 0x3030303030303030ull;
+    v = (v * 10) + (v >> 8);
+    v = (((v & 0x000000FF000000FFull) * 0x000F424000000064ull)
+         + (((v >> 16) & 0x000000FF000000FFull) * 0x0000271000000001ull)) >> 32;
+    return (std::uint32_t)v;
+}
+
+/// 解析 [p, last) 开头的连续数字，返回数字之后的位置；超过 uint64 时置 overflow 并继续跳过剩余数字
+auto parse_digits(const char* p, const char* last, std::uint64_t& value, bool& overflow) -> const char* {
+    while (p < last && *p == '0') ++p;
+    const char* significant = p;
+    std::uint64_t v = 0;
+    // 前 16 位数字不会溢出，按 8 位一组处理
+    while (last - p >= 8 && p - significant <= 8) {
+        std::uint64_t chunk = load8(p);
+        if (!is_eight_digits(chunk)) break;
+        v = v * 100000000 + parse_eight_digits(chunk);
+        p += 8;
+    }
+    overflow = false;
+    for (; p < last && is_digit(*p); ++p) {
+        auto d = (std::uint64_t)(*p - '0');
+        if (p - significant < 19) {
+            v = v * 10 + d;
+        } else if (overflow || v > (std::numeric_limits<std::uint64_t>::max() - d) / 10) {
+            overflow = true;
+        } else {
+            v = v * 10 + d;
+        }
+    }
+    value = v;
+    return p;
+}
+
+// ==================== 浮点：Eisel–Lemire ====================
+
+constexpr int SMALLEST_POWER_OF_TEN = -342;
+constexpr int LARGEST_POWER_OF_TEN = 308;
+constexpr int MANTISSA_BITS = 52;
+constexpr int INFINITE_POWER = 0x7FF;
+
+/// 二进制结果：power2 为带偏置的指数，mantissa 不含隐含的最高位
+struct AdjustedMantissa {
+    std::uint64_t mantissa;
+    int power2;
+
+    auto operator==(const AdjustedMantissa& other) const -> bool {
+        return mantissa == other.mantissa && power2 == other.power2;
+    }
+};
+
+struct U128 {
+    std::uint64_t low;
+    std::uint64_t high;
+};
+
+inline auto full_multiply(std::uint64_t a, std::uint64_t b) -> U128 {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using Wide = unsigned __int128;
+    Wide r = (Wide)a * b;
+    return {(std::uint64_t)r, (std::uint64_t)(r >> 64)};
+#else
+    std::uint64_t a_lo = (std::uint32_t)a, a_hi = a >> 32;
+    std::uint64_t b_lo = (std::uint32_t)b, b_hi = b >> 32;
+    std::uint64_t lo_lo = a_lo * b_lo;
+    std::uint64_t hi_lo = a_hi * b_lo;
+    std::uint64_t lo_hi = a_lo * b_hi;
+    std::uint64_t hi_hi = a_hi * b_hi;
+    std::uint64_t cross = (lo_lo >> 32) + (std::uint32_t)hi_lo + lo_hi;
+    return {(cross << 32) | (std::uint32_t)lo_lo, (hi_lo >> 32) + (cross >> 32) + hi_hi};
+#endif
+}
+
+inline auto leading_zeros(std::uint64_t v) -> int {
+#if defined(__GNUC__)
+    return __builtin_clzll(v);
+#else
+    int n = 0;
+    while (!(v & ((std::uint64_t)1 << 63))) {
+        v <<= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+/// w * 5^q 的高 128 位近似，只在低位可能影响结果时才乘第二个 64 位
+inline auto product_approximation(int q, std::uint64_t w) -> U128 {
+    int index = 2 * (q - SMALLEST_POWER_OF_TEN);
+    U128 first = full_multiply(w, detail::POW5_128[index]);
+    constexpr std::uint64_t precision_mask = ~(std::uint64_t)0 >> (MANTISSA_BITS + 3);
+    if ((first.high & precision_mask) == precision_mask) {
+        U128 second = full_multiply(w, detail::POW5_128[index + 1]);
+        first.low += second.high;
+        if (second.high > first.low) ++first.high;
+    }
+    return first;
+}
+
+/// floor(log2(10^q)) + 63
+inline auto power_of_ten_exponent(int q) -> int {
+    return (((152170 + 65536) * q) >> 16) + 63;
+}
+
+/// w * 10^q 正确舍入到 double（w != 0 时）。128 位乘积总能确定舍入方向
+auto compute_float(int q, std::uint64_t w) -> AdjustedMantissa {
+    if (w == 0 || q < SMALLEST_POWER_OF_TEN) return {0, 0};
+    if (q > LARGEST_POWER_OF_TEN) return {0, INFINITE_POWER};
+    int lz = leading_zeros(w);
+    w <<= lz;
+    U128 product = product_approximation(q, w);
+    int upperbit = (int)(product.high >> 63);
+    int shift = upperbit + 64 - MANTISSA_BITS - 3;
+    AdjustedMantissa answer;
+    answer.mantissa = product.high >> shift;
+    answer.power2 = power_of_ten_exponent(q) + upperbit - lz + 1023;
+    if (answer.power2 <= 0) {
+        // 非规格化数
+        if (-answer.power2 + 1 >= 64) return {0, 0};
+        answer.mantissa >>= -answer.power2 + 1;
+        answer.mantissa += answer.mantissa & 1;
+        answer.mantissa >>= 1;
+        answer.power2 = answer.mantissa < ((std::uint64_t)1 << MANTISSA_BITS) ? 0 : 1;
+        return answer;
+    }
+    // 恰好位于两个可表示值正中间时向偶数舍入，只有 q 在 [-4, 23] 内才可能出现
+    if (product.low <= 1 && q >= -4 && q <= 23 && (answer.mantissa & 3) == 1
+        && (answer.mantissa << shift) == product.high) {
+        answer.mantissa &= ~(std::uint64_t)1;
+    }
+    answer.mantissa += answer.mantissa & 1;
+    answer.mantissa >>= 1;
+    if (answer.mantissa >= ((std::uint64_t)2 << MANTISSA_BITS)) {
+        answer.mantissa = (std::uint64_t)1 << MANTISSA_BITS;
+        ++answer.power2;
+    }
+    answer.mantissa &= ~((std::uint64_t)1 << MANTISSA_BITS);
+    if (answer.power2 >= INFINITE_POWER) return {0, INFINITE_POWER};
+    return answer;
+}
+
+// ==================== 浮点：逐位十进制运算（后备路径） ====================
+// 超过 19 位有效数字且截断影响舍入时使用：在十进制数字串上反复乘除 2 的幂，
+// 直到数值落入 [1, 2) 并取出 53 位
+
+class DecimalDigits {
+public:
+    static constexpr int MAX_DIGITS = 800;
+
+    std::uint8_t digits[MAX_DIGITS];
+    int count = 0;        // 保存的位数
+    int point = 0;        // 小数点位于第 point 位之后
+    bool truncated = false;
+
+    auto trim() -> void {
+        while (count > 0 && digits[count - 1] == 0) --count;
+        if (count == 0) point = 0;
+    }
+
+    /// 乘以 2^k，k <= 60
+    auto left_shift(unsigned k) -> void {
+        std::uint8_t out[MAX_DIGITS + 20];
+        int w = count + 20;
+        std::uint64_t n = 0;
+        for (int r = count - 1; r >= 0; --r) {
+            n += (std::uint64_t)digits[r] << k;
+            std::uint64_t quo = n / 10;
+            out[--w] = (std::uint8_t)(n - 10 * quo);
+            n = quo;
+        }
+        while (n > 0) {
+            std::uint64_t quo = n / 10;
+            out[--w] = (std::uint8_t)(n - 10 * quo);
+            n = quo;
+        }
+        int produced = count + 20 - w;
+        int keep = produced < MAX_DIGITS ? produced : MAX_DIGITS;
+        for (int i = keep; i < produced; ++i) {
+            if (out[w + i] != 0) truncated = true;
+        }
+        std::memcpy(digits, out + w, (std::size_t)keep);
+        point += produced - count;
+        count = keep;
+        trim();
+    }
+
+    /// 除以 2^k，k <= 60
+    auto right_shift(unsigned k) -> void {
+        int r = 0;
+        int w = 0;
+        std::uint64_t n = 0;
+        for (; (n >> k) == 0; ++r) {
+            if (r >= count) {
+                if (n == 0) {
+                    count = 0;
+                    return;
+                }
+                while ((n >> k) == 0) {
+                    n *= 10;
+                    ++r;
+                }
+                break;
+            }
+            n = n * 10 + digits[r];
+        }
+        point -= r - 1;
+        std::uint64_t mask = ((std::uint64_t)1 << k) - 1;
+        for (; r < count; ++r) {
+            std::uint64_t digit = n >> k;
+            n &= mask;
+            digits[w++] = (std::uint8_t)digit;
+            n = n * 10 + digits[r];
+        }
+        while (n > 0) {
+            std::uint64_t digit = n >> k;
+            n &= mask;
+            if (w < MAX_DIGITS) {
+                digits[w++] = (std::uint8_t)digit;
+            } else if (digit > 0) {
+                truncated = true;
+            }
+            n *= 10;
+        }
+        count = w;
+        trim();
+    }
+
+    /// 乘以 2^k，k 可为负数
+    auto shift(int k) -> void {
+        constexpr int MAX_SHIFT = 60;
+        if (count == 0) return;
+        for (; k > MAX_SHIFT; k -= MAX_SHIFT) left_shift(MAX_SHIFT);
+        for (; k < -MAX_SHIFT; k += MAX_SHIFT) right_shift(MAX_SHIFT);
+        if (k > 0) left_shift((unsigned)k);
+        if (k < 0) right_shift((unsigned)-k);
+    }
+
+    /// 整数部分按四舍六入五成双取整
+    auto rounded_integer() const -> std::uint64_t {
+        if (point > 20) return ~(std::uint64_t)0;
+        std::uint64_t n = 0;
+        int i = 0;
+        for (; i < point && i < count; ++i) n = n * 10 + digits[i];
+        for (; i < point; ++i) n *= 10;
+        bool round_up = false;
+        if (point >= 0 && point < count) {
+            if (digits[point] == 5 && point + 1 == count) {
+                round_up = truncated || (point > 0 && digits[point - 1] % 2 == 1);
+            } else {
+                round_up = digits[point] >= 5;
+            }
+        }
+        return n + (round_up ? 1 : 0);
+    }
+
+    auto to_float() -> AdjustedMantissa {
+        // 每次移位使 point 减小或增大的位数，point 越大移位越多
+        static constexpr int POW_TAB[] = {1, 3, 6, 9, 13, 16, 19, 23, 26};
+        constexpr int POW_TAB_SIZE = sizeof(POW_TAB) / sizeof(POW_TAB[0]);
+        if (count == 0 || point < -330) return {0, 0};
+        if (point > 310) return {0, INFINITE_POWER};
+        int exp = 0;
+        while (point > 0) {
+            int n = point >= POW_TAB_SIZE ? 27 : POW_TAB[point];
+            shift(-n);
+            exp += n;
+        }
+        while (point < 0 || (point == 0 && digits[0] < 5)) {
+            int n = -point >= POW_TAB_SIZE ? 27 : POW_TAB[-point];
+            shift(n);
+            exp -= n;
+        }
+        // 现在数值位于 [0.5, 1)，换算到 [1, 2)
+        --exp;
+        if (exp < -1022) {
+            int n = -1022 - exp;
+            shift(-n);
+            exp += n;
+        }
+        if (exp + 1023 >= INFINITE_POWER) return {0, INFINITE_POWER};
+        shift(1 + MANTISSA_BITS);
+        std::uint64_t mantissa = rounded_integer();
+        if (mantissa == ((std::uint64_t)2 << MANTISSA_BITS)) {
+            mantissa >>= 1;
+            ++exp;
+            if (exp + 1023 >= INFINITE_POWER) return {0, INFINITE_POWER};
+        }
+        int power2 = exp + 1023;
+        if (!(mantissa & ((std::uint64_t)1 << MANTISSA_BITS))) power2 = 0;  // 非规格化数
+        return {mantissa & (((std::uint64_t)1 << MANTISSA_BITS) - 1), power2};
+    }
+};
+
+/// 由数字串 integer[.fraction] 和指数构造十进制数后转换
+auto slow_path(const char* integer, const char* integer_end, const char* fraction, const char* fraction_end,
+               std::int64_t exponent) -> AdjustedMantissa {
+    DecimalDigits decimal;
+    int significant = 0;
+    auto push = [&](char c) {
+        if (c == '0' && significant == 0) return false;
+        if (decimal.count < DecimalDigits::MAX_DIGITS) {
+            decimal.digits[decimal.count++] = (std::uint8_t)(c - '0');
+        } else if (c != '0') {
+            decimal.truncated = true;
+        }
+        ++significant;
+        return true;
+    };
+    for (const char* p = integer; p < integer_end; ++p) push(*p);
+    int point = significant;
+    for (const char* p = fraction; p < fraction_end; ++p) {
+        if (!push(*p)) --point;  // 小数部分的前导 0
+    }
+    std::int64_t dp = point + exponent;
+    if (dp > 100000) dp = 100000;
+    if (dp < -100000) dp = -100000;
+    decimal.point = (int)dp;
+    decimal.trim();
+    return decimal.to_float();
+}
+
+// ==================== 浮点：语法 ====================
+
+/// 精确的 10 的幂，用于尾数不超过 2^53 且 |q| <= 22 的快速路径
+constexpr double EXACT_POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+inline auto to_double(AdjustedMantissa am, bool negative) -> double {
+    std::uint64_t bits = am.mantissa | ((std::uint64_t)am.power2 << MANTISSA_BITS);
+    if (negative) bits |= (std::uint64_t)1 << 63;
+    double result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+/// 不区分大小写地匹配 ASCII 小写单词
+inline auto match_word(const char* p, const char* last, const char* word) -> std::size_t {
+    std::size_t n = std::strlen(word);
+    if ((std::size_t)(last - p) < n) return 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if ((p[i] | 0x20) != word[i]) return 0;
+    }
+    return n;
+}
+
+auto parse_special(const char* first, const char* p, const char* last, bool negative, double& value)
+    -> ParseResult {
+    if (std::size_t n = match_word(p, last, "nan")) {
+        value = negative ? -std::numeric_limits<double>::quiet_NaN() : std::numeric_limits<double>::quiet_NaN();
+        return {p + n, ParseError::None};
+    }
+    if (std::size_t n = match_word(p, last, "inf")) {
+        if (std::size_t m = match_word(p, last, "infinity")) n = m;
+        value = negative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+        return {p + n, ParseError::None};
+    }
+    return {first, ParseError::Invalid};
+}
+
+// ==================== 整数格式化 ====================
+
+constexpr char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/// 十进制位数（0 为 1 位）：由二进制位数估计，再和 10 的幂比较一次
+inline auto count_digits(std::uint64_t v) -> int {
+    static constexpr std::uint64_t POWERS[] = {
+        0, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+        1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+        100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+        1000000000000000000ull, 10000000000000000000ull,
+    };
+    int t = ((64 - leading_zeros(v | 1)) * 1233) >> 12;
+    return t - (v < POWERS[t] ? 1 : 0) + 1;
+}
+
+/// 从 end 向前写入 v 的十进制数字，每次两位
+inline auto write_digits(std::uint64_t v, char* end) -> void {
+    while (v >= 100) {
+        std::uint64_t pair = v % 100;
+        v /= 100;
+        end -= 2;
+        std::memcpy(end, DIGIT_PAIRS + 2 * pair, 2);
+    }
+    if (v >= 10) {
+        std::memcpy(end - 2, DIGIT_PAIRS + 2 * v, 2);
+    } else {
+        end[-1] = (char)('0' + v);
+    }
+}
+
+// ==================== 浮点格式化：Schubfach ====================
+// 把 c * 2^q 的舍入区间两端和中点乘以 10^-k（128 位上界近似，按奇数舍入），
+// 在区间内找位数最少的十进制数；位数相同时取最接近的，正中间时取偶数
+
+constexpr int SHORTEST_SMALLEST_POWER = -292;
+
+/// digits * 10^exponent
+struct ShortestDecimal {
+    std::uint64_t digits;
+    int exponent;
+};
+
+inline auto floor_log2_pow10(int e) -> int {
+    return (e * 1741647) >> 19;
+}
+
+inline auto floor_log10_pow2(int e) -> int {
+    return (e * 1262611) >> 22;
+}
+
+inline auto floor_log10_three_quarters_pow2(int e) -> int {
+    return (e * 1262611 - 524031) >> 22;
+}
+
+inline auto pow10_upper(int k) -> U128 {
+    int index = 2 * (k - SHORTEST_SMALLEST_POWER);
+    return {detail::POW10_128[index + 1], detail::POW10_128[index]};
+}
+
+/// (g * cp) >> 128，舍去的部分非 0 时把最低位置 1
+inline auto round_to_odd(U128 g, std::uint64_t cp) -> std::uint64_t {
+    U128 x = full_multiply(g.low, cp);
+    U128 y = full_multiply(g.high, cp);
+    std::uint64_t y0 = y.low + x.high;
+    std::uint64_t y1 = y.high + (y0 < x.high ? 1 : 0);
+    return y1 | (y0 > 1 ? 1 : 0);
+}
+
+/// (g * cp) >> 64 的 32 位版本
+inline auto round_to_odd(std::uint64_t g, std::uint32_t cp) -> std::uint32_t {
+    U128 p = full_multiply(g, cp);
+    auto y1 = (std::uint32_t)p.high;
+    auto y0 = (std::uint32_t)(p.low >> 32);
+    return y1 | (y0 > 1 ? 1 : 0);
+}
+
+/// 在舍入区间 [lower, upper]（已按是否包含端点调整）内选出结果，vb 为中点的 4 倍
+template<typename UInt>
+inline auto pick_shortest(UInt vb, UInt lower, UInt upper, int k) -> ShortestDecimal {
+    UInt s = vb / 4;
+    if (s >= 10) {
+        // 先试少一位
+        UInt sp = s / 10;
+        bool up_inside = lower <= 40 * sp;
+        bool wp_inside = 40 * sp + 40 <= upper;
+        if (up_inside != wp_inside) return {(std::uint64_t)(sp + wp_inside), k + 1};
+    }
+    bool u_inside = lower <= 4 * s;
+    bool w_inside = 4 * s + 4 <= upper;
+    if (u_inside != w_inside) return {(std::uint64_t)(s + w_inside), k};
+    UInt mid = 4 * s + 2;
+    bool round_up = vb > mid || (vb == mid && (s & 1) != 0);
+    return {(std::uint64_t)(s + round_up), k};
+}
+
+/// 有限非零 double 的最短表示，结果可能带末尾的 0
+auto shortest_decimal(std::uint64_t bits) -> ShortestDecimal {
+    std::uint64_t fraction = bits & (((std::uint64_t)1 << MANTISSA_BITS) - 1);
+    int biased = (int)((bits >> MANTISSA_BITS) & 0x7FF);
+    std::uint64_t c;
+    int q;
+    if (biased != 0) {
+        c = fraction | ((std::uint64_t)1 << MANTISSA_BITS);
+        q = biased - 1075;
+        // 小于 2^53 的整数直接输出
+        if (q <= 0 && q > -53 && (c & (((std::uint64_t)1 << -q) - 1)) == 0) return {c >> -q, 0};
+    } else {
+        c = fraction;
+        q = -1074;
+    }
+    bool even = (c & 1) == 0;
+    bool lower_closer = fraction == 0 && biased > 1;  // 2 的幂：下方的相邻值更近
+    std::uint64_t cbl = 4 * c - 2 + (lower_closer ? 1 : 0);
+    std::uint64_t cb = 4 * c;
+    std::uint64_t cbr = 4 * c + 2;
+    int k = lower_closer ? floor_log10_three_quarters_pow2(q) : floor_log10_pow2(q);
+    int h = q + floor_log2_pow10(-k) + 1;
+    U128 g = pow10_upper(-k);
+    std::uint64_t vbl = round_to_odd(g, cbl << h);
+    std::uint64_t vb = round_to_odd(g, cb << h);
+    std::uint64_t vbr = round_to_odd(g, cbr << h);
+    return pick_shortest<std::uint64_t>(vb, vbl + (even ? 0 : 1), vbr - (even ? 0 : 1), k);
+}
+
+/// 有限非零 float 的最短表示，使用同一张表的高 64 位
+auto shortest_decimal(std::uint32_t bits) -> ShortestDecimal {
+    constexpr int FLOAT_MANTISSA_BITS = 23;
+    std::uint32_t fraction = bits & ((1u << FLOAT_MANTISSA_BITS) - 1);
+    int biased = (int)((bits >> FLOAT_MANTISSA_BITS) & 0xFF);
+    std::uint32_t c;
+    int q;
+    if (biased != 0) {
+        c = fraction | (1u << FLOAT_MANTISSA_BITS);
+        q = biased - 150;
+        if (q <= 0 && q > -24 && (c & ((1u << -q) - 1)) == 0) return {c >> -q, 0};
+    } else {
+        c = fraction;
+        q = -149;
+    }
+    bool even = (c & 1) == 0;
+    bool lower_closer = fraction == 0 && biased > 1;
+    std::uint32_t cbl = 4 * c - 2 + (lower_closer ? 1 : 0);
+    std::uint32_t cb = 4 * c;
+    std::uint32_t cbr = 4 * c + 2;
+    int k = lower_closer ? floor_log10_three_quarters_pow2(q) : floor_log10_pow2(q);
+    int h = q + floor_log2_pow10(-k) + 1;
+    // 128 位的 floor + 1 换算为 64 位的 floor + 1
+    U128 wide = pow10_upper(-k);
+    std::uint64_t g = wide.high + (wide.low != 0 ? 1 : 0);
+    std::uint32_t vbl = round_to_odd(g, cbl << h);
+    std::uint32_t vb = round_to_odd(g, cb << h);
+    std::uint32_t vbr = round_to_odd(g, cbr << h);
+    return pick_shortest<std::uint32_t>(vb, vbl + (even ? 0 : 1), vbr - (even ? 0 : 1), k);
+}
+
+/// 按 Python repr 的规则写出 digits * 10^exponent
+auto write_shortest(ShortestDecimal decimal, bool negative, char* out) -> char* {
+    while (decimal.digits % 10 == 0) {
+        decimal.digits /= 10;
+        ++decimal.exponent;
+    }
+    if (negative) *out++ = '-';
+    char digits[20];
+    int n = count_digits(decimal.digits);
+    write_digits(decimal.digits, digits + n);
+    int sci = n + decimal.exponent - 1;  // 科学计数法的指数
+    if (sci >= -4 && sci < 16) {
+        if (decimal.exponent >= 0) {
+            // 整数：补 0 后加 ".0"
+            std::memcpy(out, digits, (std::size_t)n);
+            out += n;
+            std::memset(out, '0', (std::size_t)decimal.exponent);
+            out += decimal.exponent;
+            *out++ = '.';
+            *out++ = '0';
+        } else if (sci >= 0) {
+            std::memcpy(out, digits, (std::size_t)(sci + 1));
+            out += sci + 1;
+            *out++ = '.';
+            std::memcpy(out, digits + sci + 1, (std::size_t)(n - sci - 1));
+            out += n - sci - 1;
+        } else {
+            *out++ = '0';
+            *out++ = '.';
+            std::memset(out, '0', (std::size_t)(-sci - 1));
+            out += -sci - 1;
+            std::memcpy(out, digits, (std::size_t)n);
+            out += n;
+        }
+        return out;
+    }
+    *out++ = digits[0];
+    if (n > 1) {
+        *out++ = '.';
+        std::memcpy(out, digits + 1, (std::size_t)(n - 1));
+        out += n - 1;
+    }
+    *out++ = 'e';
+    *out++ = sci < 0 ? '-' : '+';
+    unsigned e = (unsigned)(sci < 0 ? -sci : sci);
+    if (e >= 100) {
+        *out++ = (char)('0' + e / 100);
+        e %= 100;
+    }
+    std::memcpy(out, DIGIT_PAIRS + 2 * e, 2);
+    return out + 2;
+}
+
+/// 0、无穷大和 NaN，其他值返回 nullptr
+auto write_special(bool negative, bool zero, bool infinite, bool nan, char* out) -> char* {
+    const char* text;
+    if (nan) {
+        text = "nan";
+    } else if (infinite) {
+        text = negative ? "-inf" : "inf";
+    } else if (zero) {
+        text = negative ? "-0.0" : "0.0";
+    } else {
+        return nullptr;
+    }
+    std::size_t n = std::strlen(text);
+    std::memcpy(out, text, n);
+    return out + n;
+}
+
+// ==================== 整串与批量 ====================
+
+inline auto skip_space(const char* p, const char* last) -> const char* {
+    while (p < last && detail::WHITESPACE_SET.contains(*p)) ++p;
+    return p;
+}
+
+inline auto skip_space_back(const char* first, const char* last) -> const char* {
+    while (last > first && detail::WHITESPACE_SET.contains(last[-1])) --last;
+    return last;
+}
+
+/// 去掉首尾空白后解析整个字段
+template<typename T, typename Parse>
+auto parse_field(const char* first, const char* last, Parse parse, T& value) -> ParseError {
+    first = skip_space(first, last);
+    last = skip_space_back(first, last);
+    ParseResult r = parse(std::string_view(first, (std::size_t)(last - first)), value);
+    if (r.error != ParseError::None) return r.error;
+    return r.ptr == last ? ParseError::None : ParseError::Invalid;
+}
+
+template<typename T, typename Parse>
+auto parse_whole(std::string_view text, Parse parse, const char* invalid, const char* out_of_range)
+    -> Result<T, String> {
+    T value{};
+    switch (parse_field(text.data(), text.data() + text.size(), parse, value)) {
+        case ParseError::None: return ok(value);
+        case ParseError::Invalid: return err<T>(invalid);
+        case ParseError::OutOfRange: return err<T>(out_of_range);
+    }
+    return err<T>(invalid);
+}
+
+inline auto column_error(ParseError error, const char* what, std::size_t row) -> String {
+    String message(error == ParseError::OutOfRange ? "out-of-range " : "invalid ");
+    message += what;
+    message += " at row ";
+    char digits[INT_CHARS_MAX];
+    message.append(digits, (std::size_t)(format_uint(row, digits) - digits));
+    return message;
+}
+
+template<typename T, typename Parse>
+auto parse_fields(const std::vector<StringView>& fields, Parse parse, const char* what)
+    -> Result<std::vector<T>, String> {
+    std::vector<T> values(fields.size());
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        const char* first = fields[i].data();
+        ParseError error = parse_field(first, first + fields[i].len(), parse, values[i]);
+        if (error != ParseError::None) return err<std::vector<T>>(column_error(error, what, i));
+    }
+    return ok(std::move(values));
+}
+
+template<typename T, typename Parse>
+auto parse_separated(StringView text, char sep, Parse parse, const char* what) -> Result<std::vector<T>, String> {
+    std::vector<T> values;
+    const char* p = text.data();
+    const char* last = p + text.len();
+    for (std::size_t row = 0; p < last; ++row) {
+        // 先按数值解析，解析结束后必须紧跟（可选空白和）分隔符
+        const char* start = p;
+        while (start < last && *start != sep && detail::WHITESPACE_SET.contains(*start)) ++start;
+        T value{};
+        ParseResult r = parse(std::string_view(start, (std::size_t)(last - start)), value);
+        const char* q = r.ptr;
+        while (q < last && *q != sep && detail::WHITESPACE_SET.contains(*q)) ++q;
+        ParseError error = r.error;
+        if (error == ParseError::None && q < last && *q != sep) error = ParseError::Invalid;
+        if (error != ParseError::None) return err<std::vector<T>>(column_error(error, what, row));
+        values.push_back(value);
+        p = q < last ? q + 1 : last;
+    }
+    return ok(std::move(values));
+}
+
+auto parse_int_view(std::string_view text, std::int64_t& value) -> ParseResult {
+    return parse_int(text, value);
+}
+
+auto parse_float_view(std::string_view text, double& value) -> ParseResult {
+    return parse_float(text, value);
+}
+
+} // namespace
+
+// ==================== 公开接口 ====================
+
+auto parse_uint(std::string_view text, std::uint64_t& value) -> ParseResult {
+    const char* first = text.data();
+    const char* last = first + text.size();
+    const char* p = first;
+    if (p < last && *p == '+') ++p;
+    if (p == last || !is_digit(*p)) return {first, ParseError::Invalid};
+    std::uint64_t magnitude;
+    bool overflow;
+    p = parse_digits(p, last, magnitude, overflow);
+    if (overflow) return {p, ParseError::OutOfRange};
+    value = magnitude;
+    return {p, ParseError::None};
+}
+
+auto parse_int(std::string_view text, std::int64_t& value) -> ParseResult {
+    const char* first = text.data();
+    const char* last = first + text.size();
+    const char* p = first;
+    bool negative = false;
+    if (p < last && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+    if (p == last || !is_digit(*p)) return {first, ParseError::Invalid};
+    std::uint64_t magnitude;
+    bool overflow;
+    p = parse_digits(p, last, magnitude, overflow);
+    constexpr auto limit = (std::uint64_t)std::numeric_limits<std::int64_t>::max();
+    if (overflow || magnitude > limit + (negative ? 1 : 0)) return {p, ParseError::OutOfRange};
+    // 先在无符号数上取负，INT64_MIN 也不会溢出
+    value = (std::int64_t)(negative ? 0 - magnitude : magnitude);
+    return {p, ParseError::None};
+}
+
+auto parse_float(std::string_view text, double& value) -> ParseResult {
+    const char* first = text.data();
+    const char* last = first + text.size();
+    const char* p = first;
+    bool negative = false;
+    if (p < last && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    // 尾数：最多累加 19 位有效数字，更多的位数只计入指数
+    const char* integer = p;
+    std::uint64_t mantissa = 0;
+    while (p < last && is_digit(*p)) {
+        mantissa = mantissa * 10 + (std::uint64_t)(*p - '0');  // 超过 19 位时结果无效，后面重新计算
+        ++p;
+    }
+    const char* integer_end = p;
+    std::int64_t digit_count = integer_end - integer;
+    const char* fraction = p;
+    const char* fraction_end = p;
+    std::int64_t exponent = 0;
+    if (p < last && *p == '.') {
+        ++p;
+        fraction = p;
+        while (last - p >= 8 && is_eight_digits(load8(p))) {
+            mantissa = mantissa * 100000000 + parse_eight_digits(load8(p));
+            p += 8;
+        }
+        while (p < last && is_digit(*p)) {
+            mantissa = mantissa * 10 + (std::uint64_t)(*p - '0');
+            ++p;
+        }
+        fraction_end = p;
+        exponent = fraction - fraction_end;
+        digit_count -= exponent;
+    }
+    if (digit_count == 0) return parse_special(first, integer, last, negative, value);
+
+    std::int64_t explicit_exponent = 0;
+    if (p < last && (*p | 0x20) == 'e') {
+        const char* e = p + 1;
+        bool negative_exponent = false;
+        if (e < last && (*e == '+' || *e == '-')) {
+            negative_exponent = *e == '-';
+            ++e;
+        }
+        if (e < last && is_digit(*e)) {
+            for (; e < last && is_digit(*e); ++e) {
+                // 过大的指数只需要保持足够大，结果已确定为 0 或无穷大
+                if (explicit_exponent < 0x10000) explicit_exponent = explicit_exponent * 10 + (*e - '0');
+            }
+            if (negative_exponent) explicit_exponent = -explicit_exponent;
+            exponent += explicit_exponent;
+            p = e;
+        }
+    }
+
+    bool truncated = false;
+    if (digit_count > 19) {
+        // 去掉前导 0 后重新计数
+        for (const char* s = integer; s < fraction_end && (*s == '0' || *s == '.'); ++s) {
+            if (*s == '0') --digit_count;
+        }
+        if (digit_count > 19) {
+            truncated = true;
+            constexpr std::uint64_t MIN_19_DIGITS = 1000000000000000000ull;
+            mantissa = 0;
+            const char* s = integer;
+            while (mantissa < MIN_19_DIGITS && s < integer_end) mantissa = mantissa * 10 + (std::uint64_t)(*s++ - '0');
+            if (mantissa >= MIN_19_DIGITS) {
+                exponent = (integer_end - s) + explicit_exponent;
+            } else {
+                s = fraction;
+                while (mantissa < MIN_19_DIGITS && s < fraction_end) mantissa = mantissa * 10 + (std::uint64_t)(*s++ - '0');
+                exponent = (fraction - s) + explicit_exponent;
+            }
+        }
+    }
+
+    double result;
+    if (!truncated && exponent >= -22 && exponent <= 22 && mantissa <= ((std::uint64_t)1 << 53)) {
+        // 尾数和 10 的幂都能精确表示为 double，一次乘除即为正确舍入的结果
+        result = (double)mantissa;
+        result = exponent < 0 ? result / EXACT_POWERS_OF_TEN[-exponent] : result * EXACT_POWERS_OF_TEN[exponent];
+        if (negative) result = -result;
+    } else {
+        int q = exponent < -100000 ? -100000 : exponent > 100000 ? 100000 : (int)exponent;
+        AdjustedMantissa am = compute_float(q, mantissa);
+        // 截断了低位时，真实值位于 mantissa 和 mantissa + 1 之间，两端结果不同就需要逐位计算
+        if (truncated && !(am == compute_float(q, mantissa + 1))) {
+            am = slow_path(integer, integer_end, fraction, fraction_end, explicit_exponent);
+        }
+        if (am.power2 == INFINITE_POWER) return {p, ParseError::OutOfRange};
+        if (am.power2 == 0 && am.mantissa == 0 && mantissa != 0) return {p, ParseError::OutOfRange};
+        result = to_double(am, negative);
+    }
+    value = result;
+    return {p, ParseError::None};
+}
+
+auto to_int(std::string_view text) -> Result<std::int64_t, String> {
+    return parse_whole<std::int64_t>(text, parse_int_view, "invalid integer format", "integer out of range");
+}
+
+auto to_float(std::string_view text) -> Result<double, String> {
+    return parse_whole<double>(text, parse_float_view, "invalid float format", "float out of range");
+}
+
+auto to_int_column(const std::vector<StringView>& fields) -> Result<std::vector<std::int64_t>, String> {
+    return parse_fields<std::int64_t>(fields, parse_int_view, "integer");
+}
+
+auto to_float_column(const std::vector<StringView>& fields) -> Result<std::vector<double>, String> {
+    return parse_fields<double>(fields, parse_float_view, "float");
+}
+
+auto to_int_column(StringView text, char sep) -> Result<std::vector<std::int64_t>, String> {
+    return parse_separated<std::int64_t>(text, sep, parse_int_view, "integer");
+}
+
+auto to_float_column(StringView text, char sep) -> Result<std::vector<double>, String> {
+    return parse_separated<double>(text, sep, parse_float_view, "float");
+}
+
+auto format_uint(std::uint64_t value, char* out) -> char* {
+    char* end = out + count_digits(value);
+    write_digits(value, end);
+    return end;
+}
+
+auto format_int(std::int64_t value, char* out) -> char* {
+    if (value < 0) {
+        *out++ = '-';
+        // 先转为无符号再取负，INT64_MIN 也不会溢出
+        return format_uint(0 - (std::uint64_t)value, out);
+    }
+    return format_uint((std::uint64_t)value, out);
+}
+
+auto format_float(double value, char* out) -> char* {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bool negative = (bits >> 63) != 0;
+    bits &= ~((std::uint64_t)1 << 63);
+    constexpr std::uint64_t EXPONENT_MASK = (std::uint64_t)INFINITE_POWER << MANTISSA_BITS;
+    if (char* end = write_special(negative, bits == 0, bits == EXPONENT_MASK, bits > EXPONENT_MASK, out)) {
+        return end;
+    }
+    return write_shortest(shortest_decimal(bits), negative, out);
+}
+
+auto format_float(float value, char* out) -> char* {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bool negative = (bits >> 31) != 0;
+    bits &= ~(1u << 31);
+    constexpr std::uint32_t EXPONENT_MASK = 0xFFu << 23;
+    if (char* end = write_special(negative, bits == 0, bits == EXPONENT_MASK, bits > EXPONENT_MASK, out)) {
+        return end;
+    }
+    return write_shortest(shortest_decimal(bits), negative, out);
+}
+
+namespace detail {
+
+auto format_fixed(double value, int precision, char* out) -> char* {
+    static constexpr std::uint64_t POWERS[] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+        1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+        100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+        1000000000000000000ull, 10000000000000000000ull,
+    };
+    if (precision < 0 || precision > 19) return nullptr;
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bool negative = (bits >> 63) != 0;
+    int biased = (int)((bits >> MANTISSA_BITS) & 0x7FF);
+    if (biased == INFINITE_POWER) return nullptr;
+    // value = m * 2^e，m * 10^precision 不超过 2^117，可以精确表示
+    std::uint64_t m = bits & (((std::uint64_t)1 << MANTISSA_BITS) - 1);
+    int e = -1074;
+    if (biased != 0) {
+        m |= (std::uint64_t)1 << MANTISSA_BITS;
+        e = biased - 1075;
+    }
+    U128 p = full_multiply(m, POWERS[precision]);
+    std::uint64_t n;
+    if (m == 0) {
+        n = 0;
+    } else if (e >= 0) {
+        if (p.high != 0 || e >= 64 || (e > 0 && (p.low >> (64 - e)) != 0)) return nullptr;
+        n = p.low << e;
+    } else if (-e >= 128) {
+        n = 0;  // 不足 2^-11
+    } else {
+        // n = p >> s，按舍去部分与一半比较决定进位
+        int s = -e;
+        std::uint64_t rem_high, rem_low, half_high, half_low;
+        if (s >= 64) {
+            int t = s - 64;
+            n = p.high >> t;
+            rem_high = t == 0 ? 0 : p.high & (((std::uint64_t)1 << t) - 1);
+            rem_low = p.low;
+            half_high = t == 0 ? 0 : (std::uint64_t)1 << (t - 1);
+            half_low = t == 0 ? (std::uint64_t)1 << 63 : 0;
+        } else {
+            if ((p.high >> s) != 0) return nullptr;
+            n = (p.low >> s) | (p.high << (64 - s));
+            rem_high = 0;
+            rem_low = p.low & (((std::uint64_t)1 << s) - 1);
+            half_high = 0;
+            half_low = (std::uint64_t)1 << (s - 1);
+        }
+        bool above = rem_high > half_high || (rem_high == half_high && rem_low > half_low);
+        bool tie = rem_high == half_high && rem_low == half_low;
+        if (above || (tie && (n & 1))) {
+            if (n == ~(std::uint64_t)0) return nullptr;
+            ++n;
+        }
+    }
+    if (negative) *out++ = '-';
+    // 至少 precision + 1 位数字，小数点插在最后 precision 位之前
+    char digits[20];
+    int count = count_digits(n);
+    write_digits(n, digits + count);
+    int integer_digits = count - precision;
+    if (integer_digits <= 0) {
+        *out++ = '0';
+    } else {
+        std::memcpy(out, digits, (std::size_t)integer_digits);
+        out += integer_digits;
+    }
+    if (precision > 0) {
+        *out++ = '.';
+        if (integer_digits < 0) {
+            std::memset(out, '0', (std::size_t)-integer_digits);
+            out += -integer_digits;
+        }
+        int from = integer_digits > 0 ? integer_digits : 0;
+        std::memcpy(out, digits + from, (std::size_t)(count - from));
+        out += count - from;
+    }
+    return out;
+}
+
+} // namespace detail
+
+// ==================== String / StringView ====================
+
+auto String::from_int(std::int64_t value) -> String {
+    char text[INT_CHARS_MAX];
+    return String(text, (SizeType)(format_int(value, text) - text));
+}
+
+auto String::from_uint(std::uint64_t value) -> String {
+    char text[INT_CHARS_MAX];
+    return String(text, (SizeType)(format_uint(value, text) - text));
+}
+
+auto String::from_float(double value) -> String {
+    char text[FLOAT_CHARS_MAX];
+    return String(text, (SizeType)(format_float(value, text) - text));
+}
+
+auto String::from_float(float value) -> String {
+    char text[FLOAT_CHARS_MAX];
+    return String(text, (SizeType)(format_float(value, text) - text));
+}
+
+
+auto String::to_int() const -> Result<std::int64_t, String> {
+    return ks::to_int(view());
+}
+
+auto String::to_float() const -> Result<double, String> {
+    return ks::to_float(view());
+}
+
+auto StringView::to_int() const -> Result<std::int64_t, String> {
+    return ks::to_int(view());
+}
+
+auto StringView::to_float() const -> Result<double, String> {
+    return ks::to_float(view());
+}
+
+} // namespace ks
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "result.hpp"
+#include "string.hpp"
+#include "string_view.hpp"
+
+namespace ks {
+
+// ==================== 数值解析 ====================
+// 与 std::from_chars 类似：不跳过空白、不依赖 locale、不读写 errno，输入不需要以 '\0' 结尾。
+// 整数每次按 8 位数字（SWAR）累加；浮点数先尝试精确的双精度快速路径，
+// 再用 Eisel–Lemire 算法由 128 位乘积直接得到正确舍入的结果，极少数无法判定的情况退回逐位的十进制运算。
+// 接受的格式：
+//   整数：[+-]数字
+//   浮点：[+-](数字[.数字] | .数字)[(e|E)[+-]数字]，以及不区分大小写的 inf、infinity、nan
+
+/// 解析错误
+enum class ParseError {
+    None,        // 成功
+    Invalid,     // 开头不是合法的数值，ptr 指向输入开头
+    OutOfRange,  // 超出类型范围，ptr 仍指向数值之后
+};
+
+struct ParseResult {
+    const char* ptr;   // 第一个未被解析的字符
+    ParseError error;
+};
+
+/// 从 text 开头解析一个数值，成功时写入 value，失败时 value 不变
+auto parse_int(std::string_view text, std::int64_t& value) -> ParseResult;
+auto parse_uint(std::string_view text, std::uint64_t& value) -> ParseResult;
+auto parse_float(std::string_view text, double& value) -> ParseResult;
+
+/// 解析整个字符串（允许首尾有 ASCII 空白）
+auto to_int(std::string_view text) -> Result<std::int64_t, String>;
+auto to_float(std::string_view text) -> Result<double, String>;
+
+// ---------- 批量解析 ----------
+// 一次解析一整列数值文本（如 CSV 的一列），任何一个字段失败时返回带行号（从 0 开始）的错误
+
+auto to_int_column(const std::vector<StringView>& fields) -> Result<std::vector<std::int64_t>, String>;
+auto to_float_column(const std::vector<StringView>& fields) -> Result<std::vector<double>, String>;
+
+/// 按 sep 分隔的一列文本，边扫描边解析、不生成中间视图；字段首尾的 ASCII 空白（包括 \r）被忽略，
+/// 末尾紧跟的一个 sep 不产生空字段
+auto to_int_column(StringView text, char sep = '\n') -> Result<std::vector<std::int64_t>, String>;
+auto to_float_column(StringView text, char sep = '\n') -> Result<std::vector<double>, String>;
+
+// ==================== 数值格式化 ====================
+// 写入调用方提供的缓冲区，返回写入内容之后的位置；不分配内存、不依赖 locale，结尾不写 '\0'
+
+/// 缓冲区至少需要的字节数
+constexpr std::size_t INT_CHARS_MAX = 20;    // -9223372036854775808
+constexpr std::size_t FLOAT_CHARS_MAX = 24;  // -2.2250738585072014e-308
+
+/// 十进制整数，每次写两位数字
+auto format_int(std::int64_t value, char* out) -> char*;
+auto format_uint(std::uint64_t value, char* out) -> char*;
+
+/// 能解析回同一个值的最短十进制表示（Schubfach 算法），格式与 Python 的 repr 相同：
+/// 十进制指数在 [-4, 16) 内时用定点表示并保留至少一位小数（1.0、0.001），
+/// 否则用科学计数法（1e+16、1.5e-05）；非有限值写为 inf、-inf、nan。
+/// float 重载按单精度取最短表示，0.1f 写为 0.1
+auto format_float(double value, char* out) -> char*;
+auto format_float(float value, char* out) -> char*;
+
+namespace detail {
+
+/// 定点表示的快速路径：保留 precision 位小数，按二进制的精确值四舍六入五成双（与 printf 的 %.*f 相同）。
+/// 只处理 precision <= 19 且 |value| * 10^precision < 2^64 的有限值，最多写出 22 字节；
+/// 其他情况返回 nullptr，由调用方改用 snprintf
+auto format_fixed(double value, int precision, char* out) -> char*;
+
+} // namespace detail
+
+} // namespace ks
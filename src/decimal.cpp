@@ -1,4 +1,6 @@
 #include "decimal.hpp"
+#include "charconv.hpp"
+#include "string_builder.hpp"
 #include <cctype>
 #include <string>
 #include <algorithm>
@@ -226,12 +228,20 @@ auto Decimal::to_ks_string() const -> String {
     return String(to_string());
 }
 
+// ========== StringBuilder 扩展 ==========
+
+auto StringBuilder::append_decimal(const Decimal& value) -> StringBuilder& {
+    std::string text = value.to_string();
+    return append(StringView(text.data(), text.size()));
+}
+
 auto Decimal::hash() const -> BigInt {
     // 简单的哈希：将 mantissa 的哈希和 exponent 组合
     // 使用 BigInt 作为哈希值
     std::hash<std::string> hasher;
     size_t mant_hash = hasher(mantissa_.to_string());
-    size_t exp_hash = hasher(std::to_string(exponent_));
+    char exp_text[INT_CHARS_MAX];
+    size_t exp_hash = hasher(std::string(exp_text, (size_t)(format_int(exponent_, exp_text) - exp_text)));
 
     BigInt mant_big(static_cast<uint64_t>(mant_hash));
     BigInt exp_big(static_cast<uint64_t>(exp_hash));
@@ -1,12 +1,19 @@
 #pragma once
 
 #include "string.hpp"
+#include "atom.hpp"
 #include "result.hpp"
+#include "check.hpp"
 #include <vector>
 #include <cstddef>
 #include <functional>
 #include <utility>
 #include <iterator>
+#include <algorithm>
+#include <optional>
+#include <new>
+#include <type_traits>
+#include <string_view>
 
 namespace ks {
 
@@ -19,28 +26,102 @@ namespace detail {
 /// 槽位状态
 enum class SlotState { Empty, Occupied, Deleted };
 
+/// 计算字符串哈希值（直接对字节视图求哈希，不拷贝字符串）
+inline auto hash_string(const String& s) -> std::size_t {
+    return std::hash<std::string_view>{}(s.view());
+}
+
 /// 哈希表条目
+/// 完整哈希值随条目一起保存：扩容时不必重新计算，查找时先比较哈希值再比较键
+/// key 和 value 只在 Occupied 状态下存活：空槽位和已删除槽位不构造任何对象，
+/// 插入时用 construct() 原地构造一次，删除时用 destroy() 析构
 template<typename T>
 struct Entry {
-    String key;
-    T value;
+    union { String key; };
+    union { T value; };
+    std::size_t hash;
     SlotState state;
 
-    Entry() : state(SlotState::Empty) {}
-    Entry(const String& k, const T& v) : key(k), value(v), state(SlotState::Occupied) {}
-    Entry(String&& k, T&& v) : key(std::move(k)), value(std::move(v)), state(SlotState::Occupied) {}
-};
+    Entry() : hash(0), state(SlotState::Empty) {}
+    Entry(const String& k, const T& v) : hash(0), state(SlotState::Empty) { construct(hash_string(k), k, v); }
+    Entry(String&& k, T&& v) : hash(0), state(SlotState::Empty) {
+        std::size_t h = hash_string(k);
+        construct(h, std::move(k), std::move(v));
+    }
 
-/// 计算字符串哈希值
-inline auto hash_string(const String& s) -> std::size_t {
-    return std::hash<std::string>{}(s.to_std_string());
-}
+    Entry(const Entry& other) : hash(0), state(SlotState::Empty) {
+        if (other.state == SlotState::Occupied) {
+            construct(other.hash, other.key, other.value);
+        }
+        state = other.state;
+    }
+
+    Entry(Entry&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : hash(0), state(SlotState::Empty) {
+        if (other.state == SlotState::Occupied) {
+            construct(other.hash, std::move(other.key), std::move(other.value));
+        }
+        state = other.state;
+    }
+
+    auto operator=(const Entry& other) -> Entry& {
+        if (this != &other) {
+            destroy();
+            if (other.state == SlotState::Occupied) {
+                construct(other.hash, other.key, other.value);
+            }
+            state = other.state;
+        }
+        return *this;
+    }
+
+    auto operator=(Entry&& other) noexcept(std::is_nothrow_move_constructible_v<T>) -> Entry& {
+        if (this != &other) {
+            destroy();
+            if (other.state == SlotState::Occupied) {
+                construct(other.hash, std::move(other.key), std::move(other.value));
+            }
+            state = other.state;
+        }
+        return *this;
+    }
+
+    ~Entry() {
+        destroy();
+    }
+
+    /// 在空槽位上原地构造键和值
+    template<typename K, typename... Args>
+    auto construct(std::size_t h, K&& k, Args&&... args) -> void {
+        hash = h;
+        new (&key) String(std::forward<K>(k));
+        new (&value) T(std::forward<Args>(args)...);
+        state = SlotState::Occupied;
+    }
+
+    /// 析构键和值，槽位变为已删除
+    auto destroy() -> void {
+        if (state == SlotState::Occupied) {
+            key.~String();
+            value.~T();
+            state = SlotState::Deleted;
+        }
+    }
+};
 
 /// 探测函数：线性探测
 inline auto next_probe(std::size_t index, std::size_t i, std::size_t capacity) -> std::size_t {
     return (index + i) % capacity;  // 线性探测：index + i
 }
 
+/// 预取地址所在的缓存行（只读），不支持的编译器上为空操作
+inline auto prefetch(const void* addr) -> void {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(addr, 0, 3);
+#else
+    (void)addr;
+#endif
+}
+
 } // namespace detail
 
 // ========== Dict 迭代器（跳过空和已删除） ==========
@@ -384,10 +465,69 @@ public:
         return default_value;
     }
 
+    /// 以 Atom 为键：直接使用驻留时算好的哈希值
+    auto get(const Atom& key) const -> Result<const T&, String> {
+        auto idx = find_index(key.str(), key.hash());
+        if (idx) {
+            return ok(entries_[*idx].value);
+        }
+        return err<const T&>("key not found");
+    }
+
+    auto get(const Atom& key, const T& default_value) const -> T {
+        auto idx = find_index(key.str(), key.hash());
+        if (idx) {
+            return entries_[*idx].value;
+        }
+        return default_value;
+    }
+
+    /// 批量查找：每 BATCH_SIZE 个键先统一计算哈希并预取起始槽位，再逐个探测，
+    /// 使多个键的缓存未命中相互重叠。out[i] 指向 keys[i] 的值，不存在时为 nullptr。
+    /// 返回命中的键数量
+    auto get_many(const String* keys, SizeType count, const T** out) const -> SizeType {
+        if (entries_.empty()) {
+            std::fill(out, out + count, nullptr);
+            return 0;
+        }
+        SizeType found = 0;
+        SizeType hashes[BATCH_SIZE];
+        for (SizeType base = 0; base < count; base += BATCH_SIZE) {
+            SizeType n = std::min(BATCH_SIZE, count - base);
+            for (SizeType j = 0; j < n; ++j) {
+                hashes[j] = detail::hash_string(keys[base + j]);
+                detail::prefetch(&entries_[hashes[j] % entries_.size()]);
+            }
+            for (SizeType j = 0; j < n; ++j) {
+                auto idx = find_index(keys[base + j], hashes[j]);
+                if (idx) {
+                    out[base + j] = &entries_[*idx].value;
+                    ++found;
+                } else {
+                    out[base + j] = nullptr;
+                }
+            }
+        }
+        return found;
+    }
+
+    auto get_many(const std::vector<String>& keys) const -> std::vector<const T*> {
+        std::vector<const T*> out(keys.size());
+        get_many(keys.data(), keys.size(), out.data());
+        return out;
+    }
+
     /// 下标访问（非 const）：如果键不存在，插入默认构造的值并返回引用
     auto operator[](const String& key) -> T& {
-        auto* entry = find_or_insert(key);
-        return entry->value;
+        return try_emplace(key).first->value;
+    }
+
+    auto operator[](String&& key) -> T& {
+        return try_emplace(std::move(key)).first->value;
+    }
+
+    auto operator[](const Atom& key) -> T& {
+        return try_emplace(key).first->value;
     }
 
     /// 下标访问（const）：如果键不存在，报错
@@ -403,13 +543,117 @@ public:
 
     /// 插入或更新键值对
     auto insert(const String& key, const T& value) -> void {
-        auto* entry = find_or_insert(key);
-        entry->value = value;
+        insert_or_assign(key, value);
     }
 
     auto insert(const String& key, T&& value) -> void {
-        auto* entry = find_or_insert(key);
-        entry->value = std::move(value);
+        insert_or_assign(key, std::move(value));
+    }
+
+    auto insert(String&& key, T&& value) -> void {
+        insert_or_assign(std::move(key), std::move(value));
+    }
+
+    auto insert(const Atom& key, const T& value) -> void {
+        insert_or_assign(key, value);
+    }
+
+    auto insert(const Atom& key, T&& value) -> void {
+        insert_or_assign(key, std::move(value));
+    }
+
+    /// 键不存在时用 args 原地构造值并插入；键已存在时什么也不做（不会构造值）。
+    /// 键和 args 可以引用本字典中的元素：需要扩容时先构造为局部对象，再移入新槽位
+    /// 返回指向该键的迭代器，以及是否发生了插入
+    template<typename... Args>
+    auto try_emplace(const String& key, Args&&... args) -> std::pair<Iterator, bool> {
+        return try_emplace_hashed(detail::hash_string(key), key, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    auto try_emplace(String&& key, Args&&... args) -> std::pair<Iterator, bool> {
+        SizeType hash = detail::hash_string(key);
+        return try_emplace_hashed(hash, std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    auto try_emplace(const Atom& key, Args&&... args) -> std::pair<Iterator, bool> {
+        return try_emplace_hashed(key.hash(), key.str(), std::forward<Args>(args)...);
+    }
+
+    /// 键不存在时插入，键已存在时把 value 赋给已有的值。key 和 value 可以引用本字典中的元素
+    template<typename V>
+    auto insert_or_assign(const String& key, V&& value) -> std::pair<Iterator, bool> {
+        return insert_or_assign_hashed(detail::hash_string(key), key, std::forward<V>(value));
+    }
+
+    template<typename V>
+    auto insert_or_assign(String&& key, V&& value) -> std::pair<Iterator, bool> {
+        SizeType hash = detail::hash_string(key);
+        return insert_or_assign_hashed(hash, std::move(key), std::forward<V>(value));
+    }
+
+    template<typename V>
+    auto insert_or_assign(const Atom& key, V&& value) -> std::pair<Iterator, bool> {
+        return insert_or_assign_hashed(key.hash(), key.str(), std::forward<V>(value));
+    }
+
+    /// 用 args 构造值：键不存在时插入，键已存在时替换旧值。
+    /// 值先构造为临时对象再移入，args 可以引用字典中的值（如 d.emplace("a", d["a"])），
+    /// 构造抛出异常时字典不变。需要原地构造、且键已存在时保留旧值的场合用 try_emplace
+    template<typename... Args>
+    auto emplace(const String& key, Args&&... args) -> std::pair<Iterator, bool> {
+        return emplace_hashed(detail::hash_string(key), key, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    auto emplace(String&& key, Args&&... args) -> std::pair<Iterator, bool> {
+        SizeType hash = detail::hash_string(key);
+        return emplace_hashed(hash, std::move(key), std::forward<Args>(args)...);
+    }
+
+    /// 批量插入或更新：先一次性扩容到能容纳整批键，再按批计算哈希、预取槽位后逐个写入
+    auto insert_many(const String* keys, const T* values, SizeType count) -> void {
+        reserve(size_ + count);
+        SizeType hashes[BATCH_SIZE];
+        for (SizeType base = 0; base < count; base += BATCH_SIZE) {
+            SizeType n = std::min(BATCH_SIZE, count - base);
+            for (SizeType j = 0; j < n; ++j) {
+                hashes[j] = detail::hash_string(keys[base + j]);
+                detail::prefetch(&entries_[hashes[j] % entries_.size()]);
+            }
+            for (SizeType j = 0; j < n; ++j) {
+                insert_or_assign_hashed(hashes[j], keys[base + j], values[base + j]);
+            }
+        }
+    }
+
+    auto insert_many(const std::vector<std::pair<String, T>>& items) -> void {
+        reserve(size_ + items.size());
+        SizeType hashes[BATCH_SIZE];
+        for (SizeType base = 0; base < items.size(); base += BATCH_SIZE) {
+            SizeType n = std::min(BATCH_SIZE, items.size() - base);
+            for (SizeType j = 0; j < n; ++j) {
+                hashes[j] = detail::hash_string(items[base + j].first);
+                detail::prefetch(&entries_[hashes[j] % entries_.size()]);
+            }
+            for (SizeType j = 0; j < n; ++j) {
+                insert_or_assign_hashed(hashes[j], items[base + j].first, items[base + j].second);
+            }
+        }
+    }
+
+    /// 预留空间：保证再插入到 n 个键之前不会触发扩容
+    auto reserve(SizeType n) -> void {
+        SizeType needed = n + deleted_count_ + 1;
+        // 移动后的字典容量为 0，从最小容量开始翻倍
+        SizeType new_capacity = std::max(entries_.size(), MIN_CAPACITY);
+        while ((double)needed / new_capacity >= LOAD_FACTOR) {
+            new_capacity *= 2;
+        }
+        if (new_capacity != entries_.size()) {
+            rehash(new_capacity);
+        }
     }
 
     /// 批量更新
@@ -422,23 +666,7 @@ public:
 
     /// 设置默认值：如果键存在，返回值；否则插入默认值并返回它
     auto setdefault(const String& key, const T& default_value = T()) -> T& {
-        auto* entry = find_or_insert(key);
-        // 如果条目是新插入的（刚创建），需要设置值？find_or_insert 在插入时会使用默认值？
-        // 我们设计 find_or_insert 返回条目指针，如果条目之前存在则直接返回，如果不存在则插入一个默认构造的条目（value 默认构造）
-        // 所以需要手动设置默认值。我们让 find_or_insert 插入默认构造，然后如果需要可以覆盖。
-        // 但 setdefault 应该只在键不存在时才设置默认值，如果存在则不改变。
-        // 我们可以在 find_or_insert 中插入默认值，然后在外部判断是否是新的，如果是新的则设置默认值。
-        // 或者我们实现一个 try_emplace 风格。简单起见，我们修改 find_or_insert 返回状态指示是否为新插入。
-        // 这里为了简单，先实现一个简单版本：
-        auto* entry = find_for_setdefault(key);
-        // 如果 entry 是新插入的，它的 value 是默认构造，我们在这里设置为 default_value
-        // 但我们需要知道是不是新插入的。我们将在私有方法中返回一个 pair。
-        // 暂时这样：
-        auto result = find_or_insert_detail(key);
-        if (result.second) { // 新插入
-            result.first->value = default_value;
-        }
-        return result.first->value;
+        return try_emplace(key, default_value).first->value;
     }
 
     /// 删除指定键，返回被删除的值（如果键不存在且未提供默认值，返回错误）
@@ -448,7 +676,7 @@ public:
             return err<T>("pop: key not found");
         }
         T value = std::move(entries_[*idx].value);
-        entries_[*idx].state = detail::SlotState::Deleted;
+        entries_[*idx].destroy();
         --size_;
         ++deleted_count_;
         return ok(std::move(value));
@@ -460,7 +688,7 @@ public:
             return default_value;
         }
         T value = std::move(entries_[*idx].value);
-        entries_[*idx].state = detail::SlotState::Deleted;
+        entries_[*idx].destroy();
         --size_;
         ++deleted_count_;
         return value;
@@ -474,7 +702,7 @@ public:
         for (auto it = entries_.rbegin(); it != entries_.rend(); ++it) {
             if (it->state == detail::SlotState::Occupied) {
                 std::pair<String, T> result(std::move(it->key), std::move(it->value));
-                it->state = detail::SlotState::Deleted;
+                it->destroy();
                 --size_;
                 ++deleted_count_;
                 return ok(std::move(result));
@@ -516,6 +744,7 @@ private:
 
     static constexpr double LOAD_FACTOR = 0.75;
     static constexpr SizeType MIN_CAPACITY = 16;
+    static constexpr SizeType BATCH_SIZE = 16;  // 批量接口一次预取的键数
 
     /// 计算负载因子
     auto load_factor() const -> double {
@@ -529,9 +758,13 @@ private:
 
     /// 查找键的索引，返回 std::optional<size_t>，如果不存在返回空
     auto find_index(const String& key) const -> std::optional<SizeType> {
+        return find_index(key, detail::hash_string(key));
+    }
+
+    /// 使用预先计算好的哈希值查找
+    auto find_index(const String& key, SizeType hash) const -> std::optional<SizeType> {
         if (entries_.empty()) return std::nullopt;
         SizeType capacity = entries_.size();
-        SizeType hash = detail::hash_string(key);
         SizeType index = hash % capacity;
         SizeType i = 0;
         while (i < capacity) {
@@ -539,7 +772,7 @@ private:
             if (entry.state == detail::SlotState::Empty) {
                 return std::nullopt; // 遇到空，停止查找
             }
-            if (entry.state == detail::SlotState::Occupied && entry.key == key) {
+            if (entry.state == detail::SlotState::Occupied && entry.hash == hash && entry.key == key) {
                 return index; // 找到
             }
             // 继续探测
@@ -549,70 +782,129 @@ private:
         return std::nullopt; // 循环了整个表，没找到
     }
 
-    /// 查找键，如果存在返回条目指针，否则返回一个可插入的位置（空或已删除）
-    /// 返回 pair<Entry*, bool>，bool 表示是否为新插入（true 表示新插入，false 表示已存在）
-    auto find_or_insert_detail(const String& key) -> std::pair<detail::Entry<T>*, bool> {
-        if (need_rehash()) {
-            rehash();
-        }
+    /// 插入新键前是否需要先扩容（移动后的字典容量为 0，也需要）
+    auto need_grow() const -> bool {
+        return entries_.empty() || need_rehash();
+    }
+
+    /// 查找键，返回 pair<槽位下标, 是否已存在>：已存在时为键所在槽位，
+    /// 否则为可插入的槽位（优先复用探测路径上第一个已删除槽位），该槽位尚未构造。
+    /// 不扩容，调用方须保证 need_grow() 为 false
+    auto find_slot(const String& key, SizeType hash) -> std::pair<SizeType, bool> {
         SizeType capacity = entries_.size();
-        SizeType hash = detail::hash_string(key);
         SizeType index = hash % capacity;
         SizeType i = 0;
         std::optional<SizeType> first_deleted;
         while (i < capacity) {
-            auto& entry = entries_[index];
+            const auto& entry = entries_[index];
             if (entry.state == detail::SlotState::Empty) {
-                // 找到空位，如果之前有已删除位置，优先使用已删除
-                if (first_deleted) {
-                    index = *first_deleted;
-                    --deleted_count_;  // <--- 修复：重用已删除槽位时减少计数
-                }
-                // 初始化条目（确保 value 被默认构造）
-                entries_[index].key = key;
-                entries_[index].value = T{};  // 安全初始化
-                entries_[index].state = detail::SlotState::Occupied;
-                ++size_;
-                return {&entries_[index], true};
+                return {first_deleted ? *first_deleted : index, false};
             }
             if (entry.state == detail::SlotState::Deleted) {
                 if (!first_deleted) {
                     first_deleted = index;
                 }
-            }
-            if (entry.state == detail::SlotState::Occupied && entry.key == key) {
-                return {&entries_[index], false}; // 已存在
+            } else if (entry.hash == hash && entry.key == key) {
+                return {index, true}; // 已存在
             }
             ++i;
             index = detail::next_probe(hash % capacity, i, capacity);
         }
+        if (first_deleted) {
+            return {*first_deleted, false};
+        }
         // 理论上不会到这里，因为表已满，应该先扩容
         check(false, "hash table full, should have rehashed");
-        return {nullptr, false};
+        return {0, false};
     }
 
-    /// 用于 setdefault 的查找，如果键存在返回条目，否则插入默认构造的条目并返回
-    /// 返回 pair<Entry*, bool>，bool 表示是否为新插入
-    auto find_or_insert(const String& key) -> detail::Entry<T>* {
-        return find_or_insert_detail(key).first;
+    /// 在 find_slot 返回的空闲槽位上原地构造键值
+    template<typename K, typename... Args>
+    auto occupy(SizeType index, SizeType hash, K&& key, Args&&... args) -> void {
+        auto& entry = entries_[index];
+        if (entry.state == detail::SlotState::Deleted) {
+            --deleted_count_;
+        }
+        entry.construct(hash, std::forward<K>(key), std::forward<Args>(args)...);
+        ++size_;
+    }
+
+    /// 扩容后插入新键。扩容会移动所有条目，而键和参数可能引用本字典中的元素
+    /// （如 d.try_emplace(k, d["a"])），所以先把它们构造为局部对象，扩容后再移入新槽位
+    template<typename K, typename... Args>
+    auto grow_and_insert(SizeType hash, K&& key, Args&&... args) -> Iterator {
+        String owned_key(std::forward<K>(key));
+        T value(std::forward<Args>(args)...);
+        rehash();
+        auto slot = find_slot(owned_key, hash);
+        occupy(slot.first, hash, std::move(owned_key), std::move(value));
+        return iterator_at(slot.first);
+    }
+
+    template<typename K, typename... Args>
+    auto try_emplace_hashed(SizeType hash, K&& key, Args&&... args) -> std::pair<Iterator, bool> {
+        if (need_grow()) {
+            auto idx = find_index(key, hash);
+            if (idx) {
+                return {iterator_at(*idx), false};
+            }
+            return {grow_and_insert(hash, std::forward<K>(key), std::forward<Args>(args)...), true};
+        }
+        auto slot = find_slot(key, hash);
+        if (!slot.second) {
+            occupy(slot.first, hash, std::forward<K>(key), std::forward<Args>(args)...);
+        }
+        return {iterator_at(slot.first), !slot.second};
     }
 
-    /// 重新哈希
+    template<typename K, typename... Args>
+    auto emplace_hashed(SizeType hash, K&& key, Args&&... args) -> std::pair<Iterator, bool> {
+        // 先构造：键已存在时 args 可能引用将被替换的旧值
+        T value(std::forward<Args>(args)...);
+        return insert_or_assign_hashed(hash, std::forward<K>(key), std::move(value));
+    }
+
+    template<typename K, typename V>
+    auto insert_or_assign_hashed(SizeType hash, K&& key, V&& value) -> std::pair<Iterator, bool> {
+        if (need_grow()) {
+            auto idx = find_index(key, hash);
+            if (!idx) {
+                return {grow_and_insert(hash, std::forward<K>(key), std::forward<V>(value)), true};
+            }
+            entries_[*idx].value = std::forward<V>(value);
+            return {iterator_at(*idx), false};
+        }
+        auto slot = find_slot(key, hash);
+        if (slot.second) {
+            entries_[slot.first].value = std::forward<V>(value);
+        } else {
+            occupy(slot.first, hash, std::forward<K>(key), std::forward<V>(value));
+        }
+        return {iterator_at(slot.first), !slot.second};
+    }
+
+    auto iterator_at(SizeType index) -> Iterator {
+        return Iterator(entries_.begin() + index, entries_.end());
+    }
+
+    /// 重新哈希（容量翻倍，不小于 MIN_CAPACITY）
     auto rehash() -> void {
-        SizeType new_capacity = entries_.size() * 2;
+        rehash(std::max(entries_.size() * 2, MIN_CAPACITY));
+    }
+
+    /// 重新哈希到指定容量
+    auto rehash(SizeType new_capacity) -> void {
         std::vector<detail::Entry<T>> new_entries(new_capacity);
         // 重新插入所有占用项
         for (auto& entry : entries_) {
             if (entry.state == detail::SlotState::Occupied) {
-                SizeType hash = detail::hash_string(entry.key);
+                SizeType hash = entry.hash;
                 SizeType index = hash % new_capacity;
                 SizeType i = 0;
                 while (true) {
                     auto& new_entry = new_entries[index];
                     if (new_entry.state == detail::SlotState::Empty) {
-                        new_entry.key = std::move(entry.key);
-                        new_entry.value = std::move(entry.value);
-                        new_entry.state = detail::SlotState::Occupied;
+                        new_entry.construct(hash, std::move(entry.key), std::move(entry.value));
                         break;
                     }
                     ++i;
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace ks {
+
+class StringBuilder;
+
+// ==================== 格式字符串语法 ====================
+// 占位符为 {[参数下标][:格式说明]}，{{ 和 }} 输出字面的花括号；'{' 后面不是数字、':' 或 '}' 时按字面输出。
+// 参数下标要么都省略（依次取参数），要么都写出，不能混用。格式说明与 Python 相同：
+//     [[fill]align][sign][#][0][width][.precision][type]
+//     align      <（左对齐）、>（右对齐）、^（居中）；默认数值右对齐，其余左对齐
+//     sign       +（正数也输出 +）、-（默认）、空格（正数输出空格）
+//     #          二、八、十六进制加 0b、0o、0x 前缀
+//     0          数值在符号和前缀之后补 0；同时指定了对齐方式时改为用 0 填充
+//     width      最小宽度，按码点计
+//     precision  浮点数的小数位数（g 为有效数字位数），字符串的最大码点数
+//     type       整数 d b o x X c；浮点数 f F e E g G %；字符串 s
+// 运行期和编译期（KS_FMT）使用同一套 constexpr 解析函数
+
+/// 一个占位符的格式说明
+struct FormatSpec {
+    char fill[4] = {' ', 0, 0, 0};  // UTF-8 编码的填充字符
+    std::uint8_t fill_len = 1;
+    char align = 0;                 // '<'、'>'、'^'，0 表示按类型默认
+    char sign = '-';
+    bool alternate = false;
+    bool zero_pad = false;
+    int width = 0;
+    int precision = -1;             // -1 表示未指定
+    char type = 0;                  // 0 表示按类型默认
+
+    /// 是否与空的格式说明相同，此时按 append_value 的默认方式输出
+    constexpr auto is_default() const -> bool {
+        return align == 0 && sign == '-' && !alternate && !zero_pad && width == 0 && precision == -1 && type == 0;
+    }
+};
+
+namespace detail {
+
+/// 宽度和精度的上限，防止格式字符串中的大数导致溢出
+constexpr int MAX_FORMAT_WIDTH = 1 << 20;
+
+constexpr auto is_format_digit(char c) -> bool {
+    return c >= '0' && c <= '9';
+}
+
+constexpr auto is_format_align(char c) -> bool {
+    return c == '<' || c == '>' || c == '^';
+}
+
+/// 解析十进制数，超过上限时返回 -1
+constexpr auto parse_format_number(std::string_view s, std::size_t& i) -> int {
+    int value = 0;
+    for (; i < s.size() && is_format_digit(s[i]); ++i) {
+        value = value * 10 + (s[i] - '0');
+        if (value > MAX_FORMAT_WIDTH) return -1;
+    }
+    return value;
+}
+
+/// 解析冒号之后的格式说明，语法错误时返回 false
+constexpr auto parse_format_spec(std::string_view s, FormatSpec& spec) -> bool {
+    std::size_t i = 0;
+    bool has_fill = false;
+    // [[fill]align]：fill 可以是任意一个 UTF-8 字符（花括号除外）
+    auto lead = (unsigned char)(s.empty() ? 0 : s[0]);
+    std::size_t fill_len = lead < 0x80 ? 1 : lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : 2;
+    if (fill_len < s.size() && is_format_align(s[fill_len]) && s[0] != '{' && s[0] != '}') {
+        for (std::size_t k = 0; k < fill_len; ++k) spec.fill[k] = s[k];
+        spec.fill_len = (std::uint8_t)fill_len;
+        spec.align = s[fill_len];
+        has_fill = true;
+        i = fill_len + 1;
+    } else if (!s.empty() && is_format_align(s[0])) {
+        spec.align = s[0];
+        i = 1;
+    }
+    if (i < s.size() && (s[i] == '+' || s[i] == '-' || s[i] == ' ')) spec.sign = s[i++];
+    if (i < s.size() && s[i] == '#') {
+        spec.alternate = true;
+        ++i;
+    }
+    if (i < s.size() && s[i] == '0') {
+        // 指定了对齐方式时 0 只作为填充字符，否则在符号和前缀之后补 0
+        spec.zero_pad = true;
+        if (!has_fill) spec.fill[0] = '0';
+        ++i;
+    }
+    spec.width = parse_format_number(s, i);
+    if (spec.width < 0) return false;
+    if (i < s.size() && s[i] == '.') {
+        ++i;
+        if (i == s.size() || !is_format_digit(s[i])) return false;
+        spec.precision = parse_format_number(s, i);
+        if (spec.precision < 0) return false;
+    }
+    if (i < s.size()) {
+        constexpr std::string_view TYPES = "bcdoxXeEfFgG%s";
+        if (TYPES.find(s[i]) == std::string_view::npos) return false;
+        spec.type = s[i++];
+    }
+    return i == s.size();
+}
+
+/// 格式说明是否适用于类型 T（按 StringBuilder::append_value 对 T 的分类）
+template<typename T>
+constexpr auto format_spec_supports(const FormatSpec& spec) -> bool {
+    char t = spec.type;
+    if constexpr (std::is_same_v<T, char>) {
+        if (t == 0 || t == 'c' || t == 's') return !spec.alternate && spec.sign == '-' && spec.precision < 0;
+        return std::string_view("bdoxX").find(t) != std::string_view::npos && spec.precision < 0;
+    } else if constexpr (std::is_integral_v<T>) {
+        return (t == 0 || std::string_view("bcdoxX").find(t) != std::string_view::npos) && spec.precision < 0;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return t == 0 || std::string_view("eEfFgG%").find(t) != std::string_view::npos;
+    } else {
+        // 字符串以及使用输出流的类型
+        return (t == 0 || t == 's') && !spec.alternate && !spec.zero_pad && spec.sign == '-';
+    }
+}
+
+/// 解析出的一段：字面文本 [begin, begin + len)，has_arg 时后面跟一个占位符
+struct FormatItem {
+    std::size_t begin = 0;
+    std::size_t len = 0;
+    bool has_arg = false;
+    std::size_t arg = 0;
+    FormatSpec spec;
+};
+
+/// 依次产生格式字符串中的各段，编译期和运行期共用
+class FormatParser {
+    std::string_view fmt_;
+    std::size_t pos_ = 0;
+    bool finished_ = false;
+    bool automatic_ = false;      // 是否用过省略下标的占位符
+    bool manual_ = false;         // 是否用过写出下标的占位符
+    std::size_t next_arg_ = 0;
+    std::size_t args_used_ = 0;
+    const char* error_ = nullptr;
+
+public:
+    constexpr explicit FormatParser(std::string_view fmt) : fmt_(fmt) {}
+
+    /// 取下一段；全部结束或出错时返回 false，出错时 error() 非空
+    constexpr auto next(FormatItem& item) -> bool {
+        if (finished_ || error_) return false;
+        std::size_t start = pos_;
+        std::size_t size = fmt_.size();
+        while (pos_ < size) {
+            char c = fmt_[pos_];
+            if ((c == '{' || c == '}') && pos_ + 1 < size && fmt_[pos_ + 1] == c) {
+                // 保留第一个花括号，跳过第二个
+                item = FormatItem{start, pos_ + 1 - start, false, 0, FormatSpec{}};
+                pos_ += 2;
+                return true;
+            }
+            if (c == '{' && pos_ + 1 < size
+                && (fmt_[pos_ + 1] == '}' || fmt_[pos_ + 1] == ':' || is_format_digit(fmt_[pos_ + 1]))) {
+                item = FormatItem{start, pos_ - start, true, 0, FormatSpec{}};
+                return parse_field(item);
+            }
+            ++pos_;
+        }
+        finished_ = true;
+        item = FormatItem{start, size - start, false, 0, FormatSpec{}};
+        return true;
+    }
+
+    constexpr auto error() const -> const char* { return error_; }
+
+    /// 格式字符串引用的参数个数：依次取时为占位符个数，写出下标时为最大下标加 1
+    constexpr auto args_used() const -> std::size_t { return args_used_; }
+
+private:
+    constexpr auto fail(const char* message) -> bool {
+        error_ = message;
+        return false;
+    }
+
+    /// pos_ 指向占位符的 '{'
+    constexpr auto parse_field(FormatItem& item) -> bool {
+        std::size_t i = pos_ + 1;
+        if (is_format_digit(fmt_[i])) {
+            int index = parse_format_number(fmt_, i);
+            if (index < 0) return fail("argument index out of range");
+            if (automatic_) return fail("cannot switch from automatic to manual argument numbering");
+            manual_ = true;
+            item.arg = (std::size_t)index;
+        } else {
+            if (manual_) return fail("cannot switch from manual to automatic argument numbering");
+            automatic_ = true;
+            item.arg = next_arg_++;
+        }
+        if (item.arg + 1 > args_used_) args_used_ = item.arg + 1;
+        std::size_t close = fmt_.find('}', i);
+        if (close == std::string_view::npos) return fail("unterminated placeholder");
+        if (fmt_[i] == ':') {
+            if (!parse_format_spec(fmt_.substr(i + 1, close - i - 1), item.spec)) return fail("invalid format spec");
+        } else if (i != close) {
+            return fail("invalid placeholder");
+        }
+        pos_ = close + 1;
+        return true;
+    }
+};
+
+/// 类型擦除后的格式化参数：值的地址和按格式说明把它写入构建器的函数，
+/// 格式说明不适用于该类型时 write 返回 false 且不写入
+struct FormatArg {
+    const void* value;
+    auto (*write)(StringBuilder& out, const void* value, const FormatSpec& spec) -> bool;
+};
+
+/// 定义在 string_builder.hpp
+template<typename T>
+auto write_format_arg(StringBuilder& out, const void* value, const FormatSpec& spec) -> bool;
+
+// ==================== 编译期格式字符串 ====================
+// KS_FMT("...") 在编译期把格式字符串拆成“字面文本 + 参数”的片段，语法错误、占位符与参数个数不符、
+// 格式说明不适用于参数类型时编译失败。输出时按片段依次追加，不再扫描格式字符串，参数直接写入输出缓冲区：
+//     print(KS_FMT("{} + {} = {:.2f}"), 1, 2, 3.0);
+//     builder.append_fmt(KS_FMT("{:>8} items"), n);
+
+/// KS_FMT 生成的类型都派生自它
+struct CompiledFormatTag {};
+
+template<typename F>
+inline constexpr bool IS_COMPILED_FORMAT = std::is_base_of_v<CompiledFormatTag, F>;
+
+template<std::size_t N>
+struct ParsedFormat {
+    FormatItem items[N] = {};
+    std::size_t count = 0;         // 实际的段数
+    std::size_t args = 0;          // 引用的参数个数
+    const char* error = nullptr;
+};
+
+/// 段数的上界：每个花括号最多结束一段，最后还有一段
+constexpr auto max_format_items(std::string_view fmt) -> std::size_t {
+    std::size_t n = 1;
+    for (char c : fmt) {
+        if (c == '{' || c == '}') ++n;
+    }
+    return n;
+}
+
+template<std::size_t N>
+constexpr auto parse_format(std::string_view fmt) -> ParsedFormat<N> {
+    ParsedFormat<N> result;
+    FormatParser parser(fmt);
+    FormatItem item;
+    while (parser.next(item)) result.items[result.count++] = item;
+    result.args = parser.args_used();
+    result.error = parser.error();
+    return result;
+}
+
+/// 格式字符串 F::text() 的解析结果，每个 KS_FMT 只解析一次（编译期）
+template<typename F>
+struct CompiledFormat {
+    static constexpr std::string_view TEXT = F::text();
+    static constexpr auto PARSED = parse_format<max_format_items(TEXT)>(TEXT);
+};
+
+} // namespace detail
+
+/// 编译期解析的格式字符串，参数必须是字符串字面量
+#define KS_FMT(literal)                                                              \
+    [] {                                                                             \
+        struct KsCompiledFormat : ::ks::detail::CompiledFormatTag {                  \
+            static constexpr auto text() -> std::string_view { return literal; }     \
+        };                                                                           \
+        return KsCompiledFormat{};                                                   \
+    }()
+
+} // namespace ks
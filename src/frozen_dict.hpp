@@ -0,0 +1,383 @@
+#pragma once
+
+#include "dict.hpp"
+#include "result.hpp"
+#include "string.hpp"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+#include <string_view>
+
+namespace ks {
+
+namespace detail {
+
+/// 64 位混合函数（splitmix64 终结器）
+inline auto mix64(std::uint64_t x) -> std::uint64_t {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/// 跨进程稳定的字符串哈希（每次处理 8 字节），用于可序列化的哈希表
+/// 与 std::hash 不同，其结果只取决于字节内容和种子，可写入磁盘
+inline auto stable_hash(const char* data, std::size_t len, std::uint64_t seed) -> std::uint64_t {
+    std::uint64_t h = seed ^ (len * 0x9e3779b97f4a7c15ULL);
+    while (len >= 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data, 8);
+        h = (h ^ word) * 0x9e3779b97f4a7c15ULL;
+        h ^= h >> 29;
+        data += 8;
+        len -= 8;
+    }
+    std::uint64_t tail = 0;
+    std::memcpy(&tail, data, len);
+    return mix64(h ^ tail);
+}
+
+/// 冻结表的文件头。整个表是一块连续、不含指针的内存，各段用相对块首的偏移定位：
+/// [FrozenHeader][pilots: u32 * bucket_count][remap: u32 * (slot_count - count)]
+/// [slots: count * slot_size][key bytes]
+/// 每个槽位依次存放 u64 键偏移、u64 键长度和值，查找时值与键信息在同一缓存行内
+/// 所有整数按小端序存放，大端平台加载时会因版本号不匹配而被拒绝
+struct FrozenHeader {
+    char magic[4];               // "KSFD"
+    std::uint32_t version;
+    std::uint64_t seed;
+    std::uint64_t count;         // 键数量
+    std::uint64_t bucket_count;  // 桶数量（每桶一个 pilot）
+    std::uint64_t slot_count;    // 哈希值域大小（>= count，多出的位置经 remap 映射回 [0, count)）
+    std::uint64_t value_size;    // sizeof(T)，加载时用于校验
+    std::uint64_t slot_size;     // 16 + value_size 向上对齐到 8
+    std::uint64_t pilots_offset;
+    std::uint64_t remap_offset;
+    std::uint64_t slots_offset;
+    std::uint64_t keys_offset;
+    std::uint64_t total_size;
+};
+
+inline constexpr std::uint32_t FROZEN_VERSION = 1;
+
+/// 把 64 位哈希映射到 [0, n)，用乘法取高位代替取模
+inline auto reduce_range(std::uint64_t hash, std::uint64_t n) -> std::uint64_t {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using Wide = unsigned __int128;
+    return (std::uint64_t)(((Wide)hash * n) >> 64);
+#else
+    return hash % n;
+#endif
+}
+
+/// 向上对齐到 8 字节
+inline auto align8(std::uint64_t n) -> std::uint64_t {
+    return (n + 7) & ~(std::uint64_t)7;
+}
+
+/// 由 pilot 计算键在值域中的位置
+inline auto frozen_position(std::uint64_t hash, std::uint32_t pilot, std::uint64_t slot_count) -> std::uint64_t {
+    return reduce_range(mix64(hash ^ ((std::uint64_t)pilot * 0x9e3779b97f4a7c15ULL)), slot_count);
+}
+
+/// 在冻结表内存块上查找键，返回槽位下标；不存在时返回 count
+/// 只计算一次哈希、做一次键比较，不探测。
+/// 要求文件头已通过 frozen_validate：pilot、remap 和槽位的读取由各段范围保证不越界，
+/// remap 的目标和槽位中的键范围来自数据本身，在这里检查，损坏的表只会查找不到
+inline auto frozen_lookup(const FrozenHeader& header, const std::uint8_t* base,
+                          std::string_view key) -> std::uint64_t {
+    if (header.count == 0) return 0;
+    std::uint64_t hash = stable_hash(key.data(), key.size(), header.seed);
+    std::uint32_t pilot;
+    std::memcpy(&pilot, base + header.pilots_offset + reduce_range(hash, header.bucket_count) * 4, 4);
+    std::uint64_t pos = frozen_position(hash, pilot, header.slot_count);
+    if (pos >= header.count) {
+        std::uint32_t remapped;
+        std::memcpy(&remapped, base + header.remap_offset + (pos - header.count) * 4, 4);
+        if (remapped >= header.count) return header.count;
+        pos = remapped;
+    }
+    std::uint64_t key_range[2];
+    std::memcpy(key_range, base + header.slots_offset + pos * header.slot_size, 16);
+    std::uint64_t keys_size = header.total_size - header.keys_offset;
+    if (key_range[1] != key.size() || key.size() > keys_size || key_range[0] > keys_size - key.size() ||
+        std::memcmp(base + header.keys_offset + key_range[0], key.data(), key.size()) != 0) {
+        return header.count;
+    }
+    return pos;
+}
+
+/// 槽位中值的地址
+inline auto frozen_value(const FrozenHeader& header, const std::uint8_t* base,
+                         std::uint64_t slot) -> const std::uint8_t* {
+    return base + header.slots_offset + slot * header.slot_size + 16;
+}
+
+/// 从 offset 起 count 个 elem 字节的元素是否都在 limit 之前，比较过程不会溢出
+inline auto frozen_section_fits(std::uint64_t offset, std::uint64_t count, std::uint64_t elem,
+                                std::uint64_t limit) -> bool {
+    return offset <= limit && count <= (limit - offset) / elem;
+}
+
+/// 校验内存块中的文件头与各段偏移，通过后返回文件头。
+/// 只读文件头，耗时与表的大小无关；各段数据的内容由 frozen_lookup 在读取时检查
+inline auto frozen_validate(const std::uint8_t* base, std::size_t size,
+                            std::size_t value_size) -> Result<FrozenHeader, String> {
+    if (size < sizeof(FrozenHeader)) {
+        return err<FrozenHeader>("frozen dict: block too small");
+    }
+    FrozenHeader header;
+    std::memcpy(&header, base, sizeof(FrozenHeader));
+    if (std::memcmp(header.magic, "KSFD", 4) != 0) {
+        return err<FrozenHeader>("frozen dict: bad magic");
+    }
+    if (header.version != FROZEN_VERSION) {
+        return err<FrozenHeader>("frozen dict: unsupported version");
+    }
+    if (header.value_size != value_size) {
+        return err<FrozenHeader>("frozen dict: value size mismatch");
+    }
+    if (header.total_size != size || header.slot_count < header.count ||
+        header.slot_size != align8(16 + value_size) ||
+        (header.count > 0 && header.bucket_count == 0)) {
+        return err<FrozenHeader>("frozen dict: corrupted header");
+    }
+    if (header.pilots_offset < sizeof(FrozenHeader) ||
+        !frozen_section_fits(header.pilots_offset, header.bucket_count, 4, header.remap_offset) ||
+        !frozen_section_fits(header.remap_offset, header.slot_count - header.count, 4, header.slots_offset) ||
+        header.slots_offset % 8 != 0 ||
+        !frozen_section_fits(header.slots_offset, header.count, header.slot_size, header.keys_offset) ||
+        header.keys_offset > size) {
+        return err<FrozenHeader>("frozen dict: section out of range");
+    }
+    return ok(header);
+}
+
+/// 为给定的键构建最小完美哈希（PTHash 风格：按桶大小降序为每个桶搜索 pilot），
+/// 写出完整的冻结表内存块。values 为按 keys 顺序排列的 T 的字节
+/// 返回空块表示当前种子下构建失败，调用方应换种子重试
+inline auto frozen_build(const std::vector<std::string_view>& keys, const std::uint8_t* values,
+                         std::size_t value_size, std::uint64_t seed) -> std::vector<std::uint8_t> {
+    std::uint64_t n = keys.size();
+    std::uint64_t bucket_count = n == 0 ? 0 : (n + 3) / 4;  // 平均每桶 4 个键
+    std::uint64_t slot_count = n == 0 ? 0 : n + n / 16 + 1; // 留出约 6% 空位以加快 pilot 搜索
+
+    std::vector<std::uint64_t> hashes(n);
+    std::vector<std::uint64_t> bucket_sizes(bucket_count + 1, 0);
+    for (std::uint64_t i = 0; i < n; ++i) {
+        hashes[i] = stable_hash(keys[i].data(), keys[i].size(), seed);
+        ++bucket_sizes[reduce_range(hashes[i], bucket_count) + 1];
+    }
+    // 计数排序：bucket_starts[b] 为桶 b 在 bucket_keys 中的起始下标
+    std::vector<std::uint64_t> bucket_starts(bucket_sizes);
+    for (std::uint64_t b = 1; b <= bucket_count; ++b) {
+        bucket_starts[b] += bucket_starts[b - 1];
+    }
+    std::vector<std::uint64_t> bucket_keys(n);
+    {
+        std::vector<std::uint64_t> cursor(bucket_starts.begin(), bucket_starts.begin() + bucket_count);
+        for (std::uint64_t i = 0; i < n; ++i) {
+            bucket_keys[cursor[reduce_range(hashes[i], bucket_count)]++] = i;
+        }
+    }
+    std::vector<std::uint64_t> order(bucket_count);
+    for (std::uint64_t b = 0; b < bucket_count; ++b) order[b] = b;
+    std::stable_sort(order.begin(), order.end(), [&](std::uint64_t a, std::uint64_t b) {
+        return bucket_sizes[a + 1] > bucket_sizes[b + 1];
+    });
+
+    std::vector<std::uint32_t> pilots(bucket_count, 0);
+    std::vector<std::uint64_t> slot_of(n);
+    std::vector<bool> taken(slot_count, false);
+    std::vector<std::uint64_t> positions;
+    for (auto b : order) {
+        std::uint64_t size = bucket_sizes[b + 1];
+        if (size == 0) break;
+        std::uint64_t start = bucket_starts[b];
+        bool placed = false;
+        for (std::uint32_t pilot = 0; pilot < (1u << 24) && !placed; ++pilot) {
+            positions.clear();
+            bool ok_pilot = true;
+            for (std::uint64_t j = 0; j < size && ok_pilot; ++j) {
+                auto pos = frozen_position(hashes[bucket_keys[start + j]], pilot, slot_count);
+                if (taken[pos] || std::find(positions.begin(), positions.end(), pos) != positions.end()) {
+                    ok_pilot = false;
+                }
+                positions.push_back(pos);
+            }
+            if (!ok_pilot) continue;
+            for (std::uint64_t j = 0; j < size; ++j) {
+                taken[positions[j]] = true;
+                slot_of[bucket_keys[start + j]] = positions[j];
+            }
+            pilots[b] = pilot;
+            placed = true;
+        }
+        if (!placed) return {};
+    }
+
+    // 把落在 [n, slot_count) 的位置依次映射到 [0, n) 中的空位，使最终槽位是最小的
+    std::vector<std::uint32_t> remap(slot_count - n, 0);
+    std::uint64_t free_pos = 0;
+    for (std::uint64_t pos = n; pos < slot_count; ++pos) {
+        if (!taken[pos]) continue;
+        while (taken[free_pos]) ++free_pos;
+        remap[pos - n] = (std::uint32_t)free_pos;
+        taken[free_pos] = true;
+    }
+    std::vector<std::uint64_t> final_slot(n);
+    for (std::uint64_t i = 0; i < n; ++i) {
+        std::uint64_t pos = slot_of[i];
+        final_slot[i] = pos >= n ? remap[pos - n] : pos;
+    }
+    std::vector<std::uint64_t> key_at(n);
+    for (std::uint64_t i = 0; i < n; ++i) {
+        key_at[final_slot[i]] = i;
+    }
+
+    FrozenHeader header;
+    std::memcpy(header.magic, "KSFD", 4);
+    header.version = FROZEN_VERSION;
+    header.seed = seed;
+    header.count = n;
+    header.bucket_count = bucket_count;
+    header.slot_count = slot_count;
+    header.value_size = value_size;
+    header.slot_size = align8(16 + value_size);
+    header.pilots_offset = align8(sizeof(FrozenHeader));
+    header.remap_offset = align8(header.pilots_offset + bucket_count * 4);
+    header.slots_offset = align8(header.remap_offset + remap.size() * 4);
+    header.keys_offset = header.slots_offset + n * header.slot_size;
+    std::uint64_t keys_size = 0;
+    for (const auto& key : keys) keys_size += key.size();
+    header.total_size = header.keys_offset + keys_size;
+
+    std::vector<std::uint8_t> block(header.total_size, 0);
+    auto* base = block.data();
+    std::memcpy(base, &header, sizeof(FrozenHeader));
+    if (bucket_count > 0) std::memcpy(base + header.pilots_offset, pilots.data(), bucket_count * 4);
+    if (!remap.empty()) std::memcpy(base + header.remap_offset, remap.data(), remap.size() * 4);
+    std::uint64_t key_offset = 0;
+    for (std::uint64_t s = 0; s < n; ++s) {
+        const auto& key = keys[key_at[s]];
+        std::uint64_t key_range[2] = {key_offset, key.size()};
+        auto* slot = base + header.slots_offset + s * header.slot_size;
+        std::memcpy(slot, key_range, 16);
+        std::memcpy(slot + 16, values + key_at[s] * value_size, value_size);
+        std::memcpy(base + header.keys_offset + key_offset, key.data(), key.size());
+        key_offset += key.size();
+    }
+    return block;
+}
+
+/// 从 Dict 构建冻结表内存块，构建失败时自动换种子重试
+template<typename T>
+auto frozen_build_from_dict(const Dict<T>& dict) -> std::vector<std::uint8_t> {
+    std::vector<std::string_view> keys;
+    std::vector<T> values;
+    keys.reserve(dict.size());
+    values.reserve(dict.size());
+    for (const auto& entry : dict) {
+        keys.push_back(entry.key.view());
+        values.push_back(entry.value);
+    }
+    for (std::uint64_t seed = 0;; ++seed) {
+        auto block = frozen_build(keys, (const std::uint8_t*)values.data(), sizeof(T), mix64(seed));
+        if (!block.empty()) return block;
+    }
+}
+
+} // namespace detail
+
+/// 只读的冻结字典：键集合在构建时固定，用最小完美哈希把每个键映射到唯一槽位，
+/// 查找只需一次哈希和一次键比较。整个表存放在一块连续、不含指针的内存中，
+/// 可以直接序列化为字节并原样加载，无需重新构建。值类型必须可平凡拷贝
+template<typename T>
+class FrozenDict {
+    static_assert(std::is_trivially_copyable_v<T>, "FrozenDict value type must be trivially copyable");
+    static_assert(alignof(T) <= 8, "FrozenDict value type alignment must not exceed 8");
+
+    std::vector<std::uint8_t> block_;
+    detail::FrozenHeader header_;
+
+public:
+    using SizeType = std::size_t;
+
+    /// 默认构造为空表
+    FrozenDict() : FrozenDict(detail::frozen_build({}, nullptr, sizeof(T), 0)) {}
+
+    FrozenDict(const FrozenDict& other) = default;
+    FrozenDict(FrozenDict&& other) noexcept = default;
+    auto operator=(const FrozenDict& other) -> FrozenDict& = default;
+    auto operator=(FrozenDict&& other) noexcept -> FrozenDict& = default;
+
+    /// 从 Dict 当前的键值构建
+    static auto from_dict(const Dict<T>& dict) -> FrozenDict {
+        return FrozenDict(detail::frozen_build_from_dict(dict));
+    }
+
+    /// 从 to_bytes() 得到的字节加载，只校验文件头和各段范围，不重新构建。
+    /// 内容损坏的字节不会导致越界读取，只会使部分键查找不到
+    static auto from_bytes(std::vector<std::uint8_t> bytes) -> Result<FrozenDict, String> {
+        auto header = detail::frozen_validate(bytes.data(), bytes.size(), sizeof(T));
+        if (header.is_err()) {
+            return err<FrozenDict>(header.error());
+        }
+        return ok(FrozenDict(std::move(bytes)));
+    }
+
+    // ========== 容量 ==========
+    auto empty() const -> bool { return header_.count == 0; }
+    auto size() const -> SizeType { return (SizeType)header_.count; }
+
+    // ========== 查找 ==========
+
+    /// 查找键，返回指向值的指针，不存在时返回 nullptr
+    auto find(const String& key) const -> const T* {
+        return find(key.view());
+    }
+
+    auto find(const char* key) const -> const T* {
+        return find(std::string_view(key));
+    }
+
+    auto find(std::string_view key) const -> const T* {
+        auto slot = detail::frozen_lookup(header_, block_.data(), key);
+        if (slot == header_.count) return nullptr;
+        return (const T*)detail::frozen_value(header_, block_.data(), slot);
+    }
+
+    /// 是否包含键
+    auto contains(const String& key) const -> bool {
+        return find(key) != nullptr;
+    }
+
+    /// 获取键对应的值，如果不存在返回默认值
+    auto get(const String& key, const T& default_value) const -> T {
+        auto* value = find(key);
+        return value ? *value : default_value;
+    }
+
+    // ========== 序列化 ==========
+
+    /// 整个表的内存块，可直接写入文件
+    auto bytes() const -> const std::vector<std::uint8_t>& {
+        return block_;
+    }
+
+    auto to_bytes() const -> std::vector<std::uint8_t> {
+        return block_;
+    }
+
+private:
+    explicit FrozenDict(std::vector<std::uint8_t> block) : block_(std::move(block)) {
+        std::memcpy(&header_, block_.data(), sizeof(detail::FrozenHeader));
+    }
+};
+
+} // namespace ks
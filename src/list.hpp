@@ -43,7 +43,7 @@ struct CheckAllocator {
 template<typename T>
 auto to_string_for_join(const T& value) -> String {
     if constexpr (std::is_arithmetic_v<T>) {
-        return String(std::to_string(value));
+        return String::from_number(value);
     } else if constexpr (std::is_same_v<T, String>) {
         return value;
     } else if constexpr (std::is_same_v<T, std::string>) {
@@ -0,0 +1,221 @@
+#include "logger.hpp"
+#include "color.hpp"
+#include <chrono>
+
+namespace ks {
+
+namespace {
+
+/// 一批日志累积到这么多字节时先交给 sink
+constexpr std::size_t BATCH_BYTES = 64 * 1024;
+
+auto level_name(LogLevel level) -> const char* {
+    switch (level) {
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info: return "INFO";
+        case LogLevel::Warn: return "WARN";
+        case LogLevel::Error: return "ERROR";
+    }
+    return "?";
+}
+
+auto level_color(LogLevel level) -> const std::string& {
+    switch (level) {
+        case LogLevel::Debug: return Color::faint;
+        case LogLevel::Info: return Color::green;
+        case LogLevel::Warn: return Color::yellow;
+        default: return Color::red;
+    }
+}
+
+/// 两位或多位十进制数，不足时补 0
+auto append_padded(StringBuilder& out, std::int64_t value, int width) -> void {
+    FormatSpec spec;
+    spec.zero_pad = true;
+    spec.fill[0] = '0';
+    spec.width = width;
+    out.append_int(value, spec);
+}
+
+/// 从 1970-01-01 起的天数换算为公历日期
+auto civil_from_days(std::int64_t days, std::int64_t& year, int& month, int& day) -> void {
+    days += 719468;
+    std::int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    auto doe = (unsigned)(days - era * 146097);
+    unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    unsigned mp = (5 * doy + 2) / 153;
+    day = (int)(doy - (153 * mp + 2) / 5 + 1);
+    month = (int)(mp < 10 ? mp + 3 : mp - 9);
+    year = (std::int64_t)yoe + era * 400 + (month <= 2);
+}
+
+} // namespace
+
+Logger::Logger(Sink& sink, const LoggerOptions& options)
+    : sink_(sink), options_(options), level_((std::uint8_t)options.level) {
+    SizeType slots = 2;
+    while (slots * SLOT_BYTES < options.capacity) slots *= 2;
+    slot_count_ = slots;
+    // 值初始化同时预先触碰所有页面，避免调用线程第一次写入时缺页
+    data_.reset(new char[slots * SLOT_BYTES]());
+    sequence_.reset(new std::atomic<std::uint64_t>[slots]);
+    for (SizeType i = 0; i < slots; ++i) sequence_[i].store(0, std::memory_order_relaxed);
+    worker_ = std::thread([this] { run(); });
+}
+
+Logger::~Logger() {
+    stop_.store(true, std::memory_order_release);
+    worker_.join();
+}
+
+auto Logger::now_ns() -> std::int64_t {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    return (std::int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+// ==================== 生产者 ====================
+
+auto Logger::push(const char* record, SizeType len) -> bool {
+    SizeType need = (len + SLOT_BYTES - 1) / SLOT_BYTES;
+    if (need > slot_count_) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+    while (true) {
+        if (tail + need - head_.load(std::memory_order_acquire) > slot_count_) {
+            if (options_.overflow == OverflowPolicy::Drop) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            std::this_thread::yield();
+            tail = tail_.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (tail_.compare_exchange_weak(tail, tail + need, std::memory_order_relaxed)) break;
+    }
+    // 认领了 [tail, tail + need) 个槽位，按字节拷贝，末尾绕回开头
+    SizeType total = slot_count_ * SLOT_BYTES;
+    SizeType offset = (SizeType)(tail % slot_count_) * SLOT_BYTES;
+    SizeType first = len < total - offset ? len : total - offset;
+    std::memcpy(data_.get() + offset, record, first);
+    std::memcpy(data_.get(), record + first, len - first);
+    sequence_[tail % slot_count_].store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+// ==================== 后台线程 ====================
+
+auto Logger::write_prefix(StringBuilder& out, const detail::LogRecordHeader& header) const -> void {
+    if (options_.timestamp) {
+        // UTC，如 2026-10-17 08:30:05.123456
+        std::int64_t seconds = header.time_ns / 1000000000;
+        std::int64_t micros = header.time_ns % 1000000000 / 1000;
+        if (micros < 0) {
+            micros += 1000000;
+            seconds -= 1;
+        }
+        std::int64_t days = (seconds >= 0 ? seconds : seconds - 86399) / 86400;
+        std::int64_t of_day = seconds - days * 86400;
+        std::int64_t year;
+        int month;
+        int day;
+        civil_from_days(days, year, month, day);
+        append_padded(out, year, 4);
+        out.append('-');
+        append_padded(out, month, 2);
+        out.append('-');
+        append_padded(out, day, 2);
+        out.append(' ');
+        append_padded(out, of_day / 3600, 2);
+        out.append(':');
+        append_padded(out, of_day / 60 % 60, 2);
+        out.append(':');
+        append_padded(out, of_day % 60, 2);
+        out.append('.');
+        append_padded(out, micros, 6);
+        out.append(' ');
+    }
+    if (options_.color) {
+        const std::string& color = level_color(header.level);
+        out.append(StringView(color.data(), color.size()));
+        out.append(level_name(header.level));
+        out.append(StringView(Color::reset.data(), Color::reset.size()));
+    } else {
+        out.append(level_name(header.level));
+    }
+    out.append(' ');
+}
+
+auto Logger::drain(StringBuilder& batch, String& scratch) -> SizeType {
+    SizeType count = 0;
+    SizeType total = slot_count_ * SLOT_BYTES;
+    std::uint64_t head = head_.load(std::memory_order_relaxed);
+    while (sequence_[head % slot_count_].load(std::memory_order_acquire) == head + 1) {
+        SizeType offset = (SizeType)(head % slot_count_) * SLOT_BYTES;
+        // 记录头可能跨过末尾，先按字节拷贝出来
+        detail::LogRecordHeader header;
+        SizeType first = sizeof(header) < total - offset ? sizeof(header) : total - offset;
+        std::memcpy((char*)&header, data_.get() + offset, first);
+        std::memcpy((char*)&header + first, data_.get(), sizeof(header) - first);
+        const char* record = data_.get() + offset;
+        if (header.size > total - offset) {
+            // 整条记录绕回了开头，拼接到 scratch 中再读
+            scratch.clear();
+            scratch.append(data_.get() + offset, total - offset);
+            scratch.append(data_.get(), header.size - (total - offset));
+            record = scratch.data();
+        }
+        write_prefix(batch, header);
+        header.format(batch, record + sizeof(header));
+        batch.append('\n');
+        head += (header.size + SLOT_BYTES - 1) / SLOT_BYTES;
+        ++count;
+        if (batch.len() >= BATCH_BYTES) {
+            // 每批只释放一次槽位，减少 head_ 所在缓存行在生产者和后台线程之间来回传递
+            head_.store(head, std::memory_order_release);
+            sink_.write(batch.view().data(), batch.len());
+            batch.clear();
+        }
+    }
+    head_.store(head, std::memory_order_release);
+    if (!batch.empty()) {
+        sink_.write(batch.view().data(), batch.len());
+        batch.clear();
+    }
+    written_.store(head, std::memory_order_release);
+    return count;
+}
+
+auto Logger::run() -> void {
+    StringBuilder batch;
+    String scratch;
+    std::uint64_t reported = 0;
+    while (true) {
+        bool stopping = stop_.load(std::memory_order_acquire);
+        SizeType count = drain(batch, scratch);
+        std::uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+        if (dropped != reported) {
+            detail::LogRecordHeader header{nullptr, options_.timestamp ? now_ns() : 0, 0, LogLevel::Warn};
+            write_prefix(batch, header);
+            batch.append_fmt(KS_FMT("logger: dropped {} messages\n"), dropped - reported);
+            sink_.write(batch.view().data(), batch.len());
+            batch.clear();
+            reported = dropped;
+        }
+        if (count == 0) {
+            if (stopping) break;
+            std::this_thread::sleep_for(std::chrono::microseconds(options_.poll_interval_us));
+        }
+    }
+    sink_.flush();
+}
+
+auto Logger::flush() -> void {
+    std::uint64_t target = tail_.load(std::memory_order_acquire);
+    while (written_.load(std::memory_order_acquire) < target) std::this_thread::yield();
+    sink_.flush();
+}
+
+} // namespace ks
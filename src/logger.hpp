@@ -0,0 +1,202 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+#include "string.hpp"
+#include "string_builder.hpp"
+#include "format.hpp"
+#include "print.hpp"
+#include "sink.hpp"
+
+namespace ks {
+
+/// 日志级别，低于 Logger 当前级别的调用直接返回
+enum class LogLevel : std::uint8_t {
+    Debug,
+    Info,
+    Warn,
+    Error,
+};
+
+/// 环形缓冲区满时的处理方式
+enum class OverflowPolicy {
+    Drop,   // 丢弃这条日志并计数，调用线程从不等待
+    Block,  // 等待后台线程腾出空间
+};
+
+struct LoggerOptions {
+    std::size_t capacity = 1 << 20;            // 环形缓冲区字节数，向上取 2 的幂
+    OverflowPolicy overflow = OverflowPolicy::Drop;
+    LogLevel level = LogLevel::Info;
+    bool color = false;                        // 级别名使用 ks::Color 着色
+    bool timestamp = true;                     // 行首写 UTC 时间（微秒）
+    std::uint32_t poll_interval_us = 1000;     // 缓冲区为空时后台线程的休眠间隔
+};
+
+namespace detail {
+
+/// 记录头，之后紧跟序列化的参数
+struct LogRecordHeader {
+    auto (*format)(StringBuilder& out, const char* payload) -> void;
+    std::int64_t time_ns;
+    std::uint32_t size;     // 包括记录头在内的字节数
+    LogLevel level;
+};
+
+/// 参数在记录中的存储类型：算术类型按值保存，其余类型保存为文本，后台线程以 StringView 读出
+template<typename T>
+using LogStored = std::conditional_t<std::is_arithmetic_v<T>, T, StringView>;
+
+template<typename T>
+auto encode_log_text(String& out, const T& value) -> void {
+    if constexpr (std::is_pointer_v<T>) {
+        if (!value) return encode_log_text(out, StringView());
+        encode_log_text(out, StringView(value));
+    } else if constexpr (std::is_convertible_v<const T&, StringView>) {
+        StringView text(value);
+        auto len = (std::uint32_t)text.len();
+        out.append((const char*)&len, sizeof(len));
+        out.append(text.data(), text.len());
+    } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        std::string_view text(value);
+        encode_log_text(out, StringView(text.data(), text.size()));
+    } else {
+        // 其他类型在调用线程按 append_value 转为文本
+        StringBuilder text;
+        text.append_value(value);
+        encode_log_text(out, StringView(text.view().data(), text.len()));
+    }
+}
+
+template<typename T>
+auto encode_log_arg(String& out, const T& value) -> void {
+    if constexpr (std::is_arithmetic_v<T>) {
+        out.append((const char*)&value, sizeof(T));
+    } else {
+        encode_log_text(out, value);
+    }
+}
+
+template<typename T>
+auto decode_log_arg(const char*& p) -> T {
+    if constexpr (std::is_arithmetic_v<T>) {
+        T value;
+        std::memcpy(&value, p, sizeof(T));
+        p += sizeof(T);
+        return value;
+    } else {
+        std::uint32_t len;
+        std::memcpy(&len, p, sizeof(len));
+        StringView text(p + sizeof(len), len);
+        p += sizeof(len) + len;
+        return text;
+    }
+}
+
+/// 后台线程调用：按编译期格式 F 读出参数并格式化
+template<typename F, typename... Stored>
+auto format_log_record(StringBuilder& out, const char* payload) -> void {
+    const char* p = payload;
+    // 花括号初始化保证从左到右依次读出
+    std::tuple<Stored...> values{decode_log_arg<Stored>(p)...};
+    (void)p;
+    std::apply([&out](const Stored&... args) { out.append_fmt(F{}, args...); }, values);
+}
+
+} // namespace detail
+
+/// 异步日志：调用线程只把参数按值序列化进无锁的多生产者环形缓冲区，
+/// 格式化和写出由后台线程完成，多条日志合并为一次 Sink::write。
+/// 格式字符串必须是 KS_FMT，在编译期检查，记录中只保存格式化函数的地址。
+///     Sink out(2);
+///     Logger log(out);
+///     log.info(KS_FMT("request {} took {:.3f} ms"), id, ms);
+/// 销毁时写出缓冲区中剩余的日志；销毁期间不能再有线程调用日志函数
+class Logger {
+public:
+    using SizeType = std::size_t;
+
+    /// sink 的生存期必须长于 Logger
+    explicit Logger(Sink& sink, const LoggerOptions& options = LoggerOptions());
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    auto operator=(const Logger&) -> Logger& = delete;
+
+    auto set_level(LogLevel level) -> void { level_.store((std::uint8_t)level, std::memory_order_relaxed); }
+    auto level() const -> LogLevel { return (LogLevel)level_.load(std::memory_order_relaxed); }
+    auto enabled(LogLevel level) const -> bool {
+        return (std::uint8_t)level >= level_.load(std::memory_order_relaxed);
+    }
+
+    /// 写入一条日志。返回 false 表示低于当前级别或被丢弃（缓冲区满，或记录比整个缓冲区还大）
+    template<typename F, typename... Args, typename = std::enable_if_t<detail::IS_COMPILED_FORMAT<F>>>
+    auto log(LogLevel level, F, const Args&... args) -> bool {
+        if (!enabled(level)) return false;
+        // 借用线程的格式化缓冲区：参数的 operator<< 中再次写日志或 print 时会得到新的缓冲区
+        detail::BorrowedFormatBuffer buffer;
+        String& staging = buffer.get();
+        detail::LogRecordHeader header{&detail::format_log_record<F, detail::LogStored<Args>...>,
+                                       options_.timestamp ? now_ns() : 0, 0, level};
+        staging.append((const char*)&header, sizeof(header));
+        (detail::encode_log_arg(staging, args), ...);
+        auto size = (std::uint32_t)staging.len();
+        std::memcpy(staging.data() + offsetof(detail::LogRecordHeader, size), &size, sizeof(size));
+        return push(staging.data(), staging.len());
+    }
+
+    template<typename F, typename... Args>
+    auto debug(F fmt, const Args&... args) -> bool { return log(LogLevel::Debug, fmt, args...); }
+    template<typename F, typename... Args>
+    auto info(F fmt, const Args&... args) -> bool { return log(LogLevel::Info, fmt, args...); }
+    template<typename F, typename... Args>
+    auto warn(F fmt, const Args&... args) -> bool { return log(LogLevel::Warn, fmt, args...); }
+    template<typename F, typename... Args>
+    auto error(F fmt, const Args&... args) -> bool { return log(LogLevel::Error, fmt, args...); }
+
+    /// 等待此前写入的日志全部交给 sink 并刷新 sink
+    auto flush() -> void;
+
+    /// 因缓冲区满或记录过大而丢弃的日志条数
+    auto dropped() const -> std::uint64_t { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    /// 环形缓冲区按 SLOT_BYTES 字节的槽位分配，一条记录占连续的若干槽位（可以绕回开头）。
+    /// 生产者用 CAS 推进 tail_ 认领槽位，写完后在首个槽位的序号中写入“位置 + 1”发布；
+    /// 后台线程按顺序读取已发布的记录，处理完后推进 head_ 释放槽位
+    static constexpr SizeType SLOT_BYTES = 32;
+
+    Sink& sink_;
+    LoggerOptions options_;
+    std::atomic<std::uint8_t> level_;
+    SizeType slot_count_;
+    std::unique_ptr<char[]> data_;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> sequence_;
+    alignas(64) std::atomic<std::uint64_t> tail_{0};
+    alignas(64) std::atomic<std::uint64_t> head_{0};
+    alignas(64) std::atomic<std::uint64_t> dropped_{0};
+    std::atomic<std::uint64_t> written_{0};    // 此位置之前的记录已交给 sink
+    std::atomic<bool> stop_{false};
+    std::thread worker_;
+
+    static auto now_ns() -> std::int64_t;
+
+    /// 把序列化好的记录放入环形缓冲区
+    auto push(const char* record, SizeType len) -> bool;
+
+    auto run() -> void;
+
+    /// 按顺序格式化已发布的记录并交给 sink，返回处理的条数
+    auto drain(StringBuilder& batch, String& scratch) -> SizeType;
+
+    auto write_prefix(StringBuilder& out, const detail::LogRecordHeader& header) const -> void;
+};
+
+} // namespace ks
@@ -0,0 +1,157 @@
+#include "mapped_dict.hpp"
+#include <cstdio>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace ks {
+namespace detail {
+
+// ==================== MappedFile ====================
+
+#ifdef _WIN32
+
+MappedFile::MappedFile() : data_(nullptr), size_(0), file_handle_(nullptr), mapping_handle_(nullptr) {}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(other.data_), size_(other.size_),
+      file_handle_(other.file_handle_), mapping_handle_(other.mapping_handle_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.file_handle_ = nullptr;
+    other.mapping_handle_ = nullptr;
+}
+
+auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile& {
+    if (this != &other) {
+        release();
+        data_ = other.data_;
+        size_ = other.size_;
+        file_handle_ = other.file_handle_;
+        mapping_handle_ = other.mapping_handle_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.file_handle_ = nullptr;
+        other.mapping_handle_ = nullptr;
+    }
+    return *this;
+}
+
+auto MappedFile::release() -> void {
+    if (data_) UnmapViewOfFile(data_);
+    if (mapping_handle_) CloseHandle((HANDLE)mapping_handle_);
+    if (file_handle_) CloseHandle((HANDLE)file_handle_);
+    data_ = nullptr;
+    size_ = 0;
+    file_handle_ = nullptr;
+    mapping_handle_ = nullptr;
+}
+
+auto MappedFile::open(const String& path) -> Result<MappedFile, String> {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return err<MappedFile>("mapped file: cannot open file");
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        return err<MappedFile>("mapped file: empty or unreadable file");
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return err<MappedFile>("mapped file: CreateFileMapping failed");
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return err<MappedFile>("mapped file: MapViewOfFile failed");
+    }
+    MappedFile result;
+    result.data_ = (const std::uint8_t*)view;
+    result.size_ = (std::size_t)file_size.QuadPart;
+    result.file_handle_ = file;
+    result.mapping_handle_ = mapping;
+    return ok(std::move(result));
+}
+
+#else
+
+MappedFile::MappedFile() : data_(nullptr), size_(0) {}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept : data_(other.data_), size_(other.size_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+}
+
+auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile& {
+    if (this != &other) {
+        release();
+        data_ = other.data_;
+        size_ = other.size_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+auto MappedFile::release() -> void {
+    if (data_) munmap((void*)data_, size_);
+    data_ = nullptr;
+    size_ = 0;
+}
+
+auto MappedFile::open(const String& path) -> Result<MappedFile, String> {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return err<MappedFile>("mapped file: cannot open file");
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        return err<MappedFile>("mapped file: empty or unreadable file");
+    }
+    void* addr = mmap(nullptr, (std::size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // 映射建立后即可关闭描述符
+    if (addr == MAP_FAILED) {
+        return err<MappedFile>("mapped file: mmap failed");
+    }
+    // 哈希查找的访问模式是随机的，关闭内核预读
+    madvise(addr, (std::size_t)st.st_size, MADV_RANDOM);
+    MappedFile result;
+    result.data_ = (const std::uint8_t*)addr;
+    result.size_ = (std::size_t)st.st_size;
+    return ok(std::move(result));
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+    release();
+}
+
+// ==================== 文件写入 ====================
+
+auto write_file(const String& path, const std::uint8_t* data, std::size_t size) -> Result<void, String> {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        return err<void>("write file: cannot open file");
+    }
+    std::size_t written = std::fwrite(data, 1, size, file);
+    bool closed = std::fclose(file) == 0;
+    if (written != size || !closed) {
+        return err<void>("write file: write failed");
+    }
+    return ok();
+}
+
+} // namespace detail
+} // namespace ks
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "frozen_dict.hpp"
+#include "result.hpp"
+#include "string.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+namespace ks {
+
+namespace detail {
+
+/// 只读内存映射文件（RAII），析构时解除映射
+class MappedFile {
+    const std::uint8_t* data_;
+    std::size_t size_;
+#ifdef _WIN32
+    void* file_handle_;
+    void* mapping_handle_;
+#endif
+
+public:
+    MappedFile();
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    ~MappedFile();
+
+    auto operator=(const MappedFile& other) -> MappedFile& = delete;
+    auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+    /// 以只读、进程间共享的方式映射整个文件
+    static auto open(const String& path) -> Result<MappedFile, String>;
+
+    auto data() const -> const std::uint8_t* { return data_; }
+    auto size() const -> std::size_t { return size_; }
+
+private:
+    auto release() -> void;
+};
+
+/// 把字节块完整写入文件（覆盖已有文件）
+auto write_file(const String& path, const std::uint8_t* data, std::size_t size) -> Result<void, String>;
+
+} // namespace detail
+
+/// 把 FrozenDict 的内存块写入文件，之后可用 MappedDict 直接映射读取
+template<typename T>
+auto save_frozen(const FrozenDict<T>& dict, const String& path) -> Result<void, String> {
+    return detail::write_file(path, dict.bytes().data(), dict.bytes().size());
+}
+
+/// 从 Dict 构建冻结表并写入文件
+template<typename T>
+auto save_frozen(const Dict<T>& dict, const String& path) -> Result<void, String> {
+    auto block = detail::frozen_build_from_dict(dict);
+    return detail::write_file(path, block.data(), block.size());
+}
+
+/// 基于内存映射的只读字典：文件格式与 FrozenDict::to_bytes() 相同，
+/// 打开时只映射文件并校验文件头，查找直接在映射的字节上进行，
+/// 启动开销为 O(1)，且多个进程映射同一文件时共享物理页。
+/// 截断或损坏的文件在打开时被拒绝，或只会使部分键查找不到（见 frozen_lookup）；
+/// 但文件在映射期间被其他进程截断时，访问超出新长度的页面会收到 SIGBUS
+template<typename T>
+class MappedDict {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedDict value type must be trivially copyable");
+    static_assert(alignof(T) <= 8, "MappedDict value type alignment must not exceed 8");
+
+    detail::MappedFile file_;
+    detail::FrozenHeader header_;
+
+public:
+    using SizeType = std::size_t;
+
+    MappedDict(const MappedDict& other) = delete;
+    MappedDict(MappedDict&& other) noexcept = default;
+    auto operator=(const MappedDict& other) -> MappedDict& = delete;
+    auto operator=(MappedDict&& other) noexcept -> MappedDict& = default;
+
+    /// 映射由 save_frozen 写出的文件
+    static auto open(const String& path) -> Result<MappedDict, String> {
+        auto file = detail::MappedFile::open(path);
+        if (file.is_err()) {
+            return err<MappedDict>(file.error());
+        }
+        auto header = detail::frozen_validate(file.value().data(), file.value().size(), sizeof(T));
+        if (header.is_err()) {
+            return err<MappedDict>(header.error());
+        }
+        return ok(MappedDict(std::move(file).value(), header.value()));
+    }
+
+    // ========== 容量 ==========
+    auto empty() const -> bool { return header_.count == 0; }
+    auto size() const -> SizeType { return (SizeType)header_.count; }
+
+    // ========== 查找 ==========
+
+    /// 查找键，返回指向映射内存中值的指针，不存在时返回 nullptr
+    auto find(const String& key) const -> const T* {
+        return find(key.view());
+    }
+
+    auto find(const char* key) const -> const T* {
+        return find(std::string_view(key));
+    }
+
+    auto find(std::string_view key) const -> const T* {
+        auto slot = detail::frozen_lookup(header_, file_.data(), key);
+        if (slot == header_.count) return nullptr;
+        return (const T*)detail::frozen_value(header_, file_.data(), slot);
+    }
+
+    /// 是否包含键
+    auto contains(const String& key) const -> bool {
+        return find(key) != nullptr;
+    }
+
+    /// 获取键对应的值，如果不存在返回默认值
+    auto get(const String& key, const T& default_value) const -> T {
+        auto* value = find(key);
+        return value ? *value : default_value;
+    }
+
+private:
+    MappedDict(detail::MappedFile file, const detail::FrozenHeader& header)
+        : file_(std::move(file)), header_(header) {}
+};
+
+} // namespace ks
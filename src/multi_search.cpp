@@ -0,0 +1,218 @@
+#include "multi_search.hpp"
+#include "check.hpp"
+#include <cstring>
+
+namespace ks {
+
+// ==================== 构建 ====================
+
+MultiSearcher::MultiSearcher(const std::vector<String>& patterns) : patterns_(patterns) {
+    build();
+}
+
+MultiSearcher::MultiSearcher(const std::vector<String>& patterns, const std::vector<String>& replacements)
+    : patterns_(patterns), replacements_(replacements) {
+    check(patterns_.size() == replacements_.size(), "MultiSearcher: patterns and replacements differ in size");
+    build();
+}
+
+MultiSearcher::MultiSearcher(const Dict<String>& replacements) {
+    patterns_.reserve(replacements.size());
+    replacements_.reserve(replacements.size());
+    for (auto item : replacements.items()) {
+        patterns_.push_back(item.first);
+        replacements_.push_back(item.second);
+    }
+    build();
+}
+
+auto MultiSearcher::build() -> void {
+    // 字节等价类：只有出现在模式串中的字节需要单独一列，其余字节共用第 0 列
+    for (int c = 0; c < 256; ++c) {
+        byte_class_[c] = 0;
+    }
+    class_count_ = 1;
+    first_byte_count_ = 0;
+    first_byte_ = 0;
+    max_len_ = 0;
+    for (const auto& pattern : patterns_) {
+        if (pattern.len() > max_len_) max_len_ = pattern.len();
+        for (char ch : pattern) {
+            auto b = (unsigned char)ch;
+            if (byte_class_[b] == 0) byte_class_[b] = (std::uint16_t)class_count_++;
+        }
+        if (!pattern.empty() && !first_bytes_.contains(pattern[0])) {
+            first_bytes_.add(pattern[0]);
+            first_byte_ = pattern[0];
+            ++first_byte_count_;
+        }
+    }
+
+    // 字典树：状态 0 为根，根不会是任何状态的子节点，因此转移为 0 表示没有子节点
+    next_.assign(class_count_, 0);
+    depth_.assign(1, 0);
+    match_.assign(1, NO_MATCH);
+    for (SizeType index = 0; index < patterns_.size(); ++index) {
+        const auto& pattern = patterns_[index];
+        if (pattern.empty()) continue;
+        std::uint32_t state = 0;
+        for (char ch : pattern) {
+            auto slot = state * class_count_ + byte_class_[(unsigned char)ch];
+            if (next_[slot] == 0) {
+                auto child = (std::uint32_t)depth_.size();
+                next_.resize(next_.size() + class_count_, 0);
+                depth_.push_back(depth_[state] + 1);
+                match_.push_back(NO_MATCH);
+                next_[slot] = child;
+            }
+            state = next_[slot];
+        }
+        // 重复的模式串以第一次出现的为准
+        if (match_[state] == NO_MATCH) match_[state] = (std::uint32_t)index;
+    }
+
+    // 按层次计算失败链接，并把缺失的转移补全为完整的 DFA
+    std::vector<std::uint32_t> fail(depth_.size(), 0);
+    std::vector<std::uint32_t> queue;
+    queue.reserve(depth_.size());
+    shorter_.assign(patterns_.size(), NO_MATCH);
+    for (SizeType cls = 0; cls < class_count_; ++cls) {
+        if (next_[cls] != 0) queue.push_back(next_[cls]);
+    }
+    for (SizeType head = 0; head < queue.size(); ++head) {
+        std::uint32_t state = queue[head];
+        // 自身是模式串终点时它就是最长的，否则继承失败链接上的最长命中。
+        // 失败链接的深度更小，已经处理过，它的 match_ 就是该模式串最长的真后缀模式串
+        if (match_[state] == NO_MATCH) {
+            match_[state] = match_[fail[state]];
+        } else {
+            shorter_[match_[state]] = match_[fail[state]];
+        }
+        const std::uint32_t* fallback = &next_[fail[state] * class_count_];
+        std::uint32_t* row = &next_[state * class_count_];
+        for (SizeType cls = 0; cls < class_count_; ++cls) {
+            if (row[cls] != 0) {
+                fail[row[cls]] = fallback[cls];
+                queue.push_back(row[cls]);
+            } else {
+                row[cls] = fallback[cls];
+            }
+        }
+    }
+}
+
+// ==================== 查找 ====================
+
+auto MultiSearcher::skip_to_start(const char* text, SizeType pos, SizeType len) const -> SizeType {
+    if (first_byte_count_ == 1) {
+        auto* found = (const char*)std::memchr(text + pos, first_byte_, len - pos);
+        return found ? (SizeType)(found - text) : len;
+    }
+    while (pos < len && !first_bytes_.contains(text[pos])) ++pos;
+    return pos;
+}
+
+auto MultiSearcher::next_match(const char* text, SizeType len, SizeType pos) const -> std::optional<MultiMatch> {
+    if (first_byte_count_ == 0) return std::nullopt;
+    std::optional<MultiMatch> best;
+    std::uint32_t state = 0;
+    for (SizeType i = pos; i < len; ++i) {
+        if (state == 0) {
+            i = skip_to_start(text, i, len);
+            if (i == len) break;
+        }
+        state = next_[state * class_count_ + byte_class_[(unsigned char)text[i]]];
+        std::uint32_t index = match_[state];
+        if (index != NO_MATCH) {
+            // 以 i 结尾的最长模式串，即此处起点最靠左的命中
+            SizeType start = i + 1 - patterns_[index].len();
+            if (!best || start < best->start || (start == best->start && i + 1 > best->end)) {
+                best = MultiMatch{start, i + 1, index};
+            }
+        }
+        // 之后的命中起点不会早于 i + 1 - depth，早于它的候选已经确定是最左最长的
+        if (best && best->start + depth_[state] < i + 1) break;
+    }
+    return best;
+}
+
+template<typename Emit>
+auto MultiSearcher::scan_all(const char* text, SizeType len, Emit&& emit) const -> void {
+    if (first_byte_count_ == 0) return;
+    // 逐个命中地调用 next_match 时，每次都要从命中末尾重新扫描，为确认没有更长的候选而读过的文本
+    // 会被反复读取，最坏 O(n * 最长模式串)。这里自动机状态贯穿整个文本只扫描一遍：
+    // 以每个起点开始的最长命中记在环形缓冲区里，起点确定不会再有命中时按从左到右的顺序取出。
+    SizeType window = 1;
+    while (window <= max_len_) window <<= 1;
+    const SizeType mask = window - 1;
+    std::vector<std::uint32_t> longest(window, NO_MATCH);  // longest[start & mask]
+    SizeType floor = 0;     // 上一个命中的末尾，起点在它之前的命中已被覆盖
+    SizeType pending = 0;   // 起点小于 pending 的候选都已确定
+    // 确定起点小于 limit 的候选：不与上一个命中重叠的就是下一个最左最长命中
+    auto settle = [&](SizeType limit) {
+        for (; pending < limit; ++pending) {
+            std::uint32_t index = longest[pending & mask];
+            if (index == NO_MATCH) continue;
+            longest[pending & mask] = NO_MATCH;
+            if (pending < floor) continue;
+            floor = pending + patterns_[index].len();
+            emit(MultiMatch{pending, floor, index});
+        }
+    };
+    std::uint32_t state = 0;
+    for (SizeType i = 0; i < len; ++i) {
+        if (state == 0) {
+            // 根状态下所有起点都已确定，缓冲区为空，可以直接跳过
+            i = skip_to_start(text, i, len);
+            if (i == len) break;
+            pending = i;
+        }
+        state = next_[state * class_count_ + byte_class_[(unsigned char)text[i]]];
+        // 以 i 结尾的模式串从长到短、起点从左到右排列；同一起点后出现的命中更长
+        for (std::uint32_t index = match_[state]; index != NO_MATCH; index = shorter_[index]) {
+            SizeType start = i + 1 - patterns_[index].len();
+            if (start >= floor) longest[start & mask] = index;
+        }
+        // 之后的命中起点不会早于 i + 1 - depth，早于它的起点已经确定
+        settle(i + 1 - depth_[state]);
+    }
+    settle(len);
+}
+
+auto MultiSearcher::find_any(StringView text, SizeType start) const -> std::optional<MultiMatch> {
+    if (start > text.len()) return std::nullopt;
+    return next_match(text.data(), text.len(), start);
+}
+
+auto MultiSearcher::count_all(StringView text) const -> SizeType {
+    SizeType count = 0;
+    scan_all(text.data(), text.len(), [&](const MultiMatch&) { ++count; });
+    return count;
+}
+
+auto MultiSearcher::replace_all(StringView text) const -> String {
+    return replace_all(text, replacements_);
+}
+
+auto MultiSearcher::replace_all(StringView text, const std::vector<String>& replacements) const -> String {
+    check(replacements.size() == patterns_.size(), "MultiSearcher: replacements do not match patterns");
+    String result;
+    result.reserve(text.len());
+    SizeType pos = 0;
+    scan_all(text.data(), text.len(), [&](const MultiMatch& found) {
+        result.append(text.data() + pos, found.start - pos);
+        const auto& replacement = replacements[found.pattern];
+        result.append(replacement.c_str(), replacement.len());
+        pos = found.end;
+    });
+    result.append(text.data() + pos, text.len() - pos);
+    return result;
+}
+
+// ==================== String 多模式替换 ====================
+
+auto String::replace_all(const Dict<String>& replacements) const -> String {
+    return MultiSearcher(replacements).replace_all(*this);
+}
+
+} // namespace ks
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "ascii.hpp"
+#include "dict.hpp"
+#include "string.hpp"
+#include "string_view.hpp"
+
+namespace ks {
+
+/// 多模式匹配的一次命中：text[start, end) 等于第 pattern 个模式串
+struct MultiMatch {
+    std::size_t start;
+    std::size_t end;
+    std::size_t pattern;
+};
+
+/// 基于 Aho–Corasick 自动机的多模式查找器，一遍扫描即可同时查找所有模式串。
+/// 匹配规则为最左最长：取起点最靠左的命中，起点相同时取最长的模式串，命中之间互不重叠。
+/// 自动机为稠密转移表，字节先映射到等价类以压缩表宽；空模式串会被忽略
+class MultiSearcher {
+    std::vector<String> patterns_;
+    std::vector<String> replacements_;
+    std::uint16_t byte_class_[256];       // 字节 -> 等价类，未出现在任何模式串中的字节为 0
+    std::size_t class_count_;
+    std::vector<std::uint32_t> next_;     // next_[state * class_count_ + cls]
+    std::vector<std::uint32_t> depth_;    // 状态对应前缀的长度
+    std::vector<std::uint32_t> match_;    // 以该状态结尾的最长模式串，NO_MATCH 表示没有
+    std::vector<std::uint32_t> shorter_;  // shorter_[pattern]：是该模式串真后缀的最长模式串
+    std::size_t max_len_;                 // 最长模式串的长度
+    detail::ByteSet first_bytes_;         // 模式串首字节集合，用于在根状态快速跳过
+    std::size_t first_byte_count_;
+    char first_byte_;                     // 只有一种首字节时用 memchr 跳过
+
+public:
+    using SizeType = std::size_t;
+
+    static constexpr std::uint32_t NO_MATCH = 0xFFFFFFFFu;
+
+    explicit MultiSearcher(const std::vector<String>& patterns);
+
+    /// 同时指定每个模式串的替换串，供 replace_all(text) 使用
+    MultiSearcher(const std::vector<String>& patterns, const std::vector<String>& replacements);
+
+    /// 以字典的键为模式串、值为替换串构建
+    explicit MultiSearcher(const Dict<String>& replacements);
+
+    auto pattern_count() const -> SizeType { return patterns_.size(); }
+    auto pattern(SizeType index) const -> const String& { return patterns_[index]; }
+
+    /// 从 start 开始查找第一个命中，没有命中返回空
+    auto find_any(StringView text, SizeType start = 0) const -> std::optional<MultiMatch>;
+
+    /// 所有模式串不重叠命中的总次数
+    auto count_all(StringView text) const -> SizeType;
+
+    /// 一遍扫描把所有命中替换为对应的替换串（需要构建时提供替换串）
+    auto replace_all(StringView text) const -> String;
+
+    /// 使用给定的替换串列表，replacements[i] 对应第 i 个模式串
+    auto replace_all(StringView text, const std::vector<String>& replacements) const -> String;
+
+private:
+    auto build() -> void;
+    auto skip_to_start(const char* text, SizeType pos, SizeType len) const -> SizeType;
+    auto next_match(const char* text, SizeType len, SizeType pos) const -> std::optional<MultiMatch>;
+    template<typename Emit>
+    auto scan_all(const char* text, SizeType len, Emit&& emit) const -> void;
+};
+
+} // namespace ks
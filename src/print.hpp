@@ -1,110 +1,250 @@
 #pragma once
 
 #include "string.hpp"
+#include "string_builder.hpp"
+#include "sink.hpp"
+#include <algorithm>
 #include <cstdio>
+#include <iterator>
 #include <string>
-#include <sstream>
 #include <utility>
 
 namespace ks {
 
 namespace detail {
 
-/// 将任意类型转换为 ks::String 的内部辅助函数
-template<typename T>
-auto to_string_impl(T&& value) -> String {
-    using RawType = std::decay_t<T>;
-    if constexpr (std::is_arithmetic_v<RawType>) {
-        // 算术类型使用 std::to_string
-        return String(std::to_string(std::forward<T>(value)));
-    } else if constexpr (std::is_same_v<RawType, String>) {
-        // 已经是 ks::String，直接转发
-        return std::forward<T>(value);
-    } else if constexpr (std::is_same_v<RawType, std::string>) {
-        // std::string 转换为 ks::String
-        return String(std::forward<T>(value));
-    } else if constexpr (std::is_same_v<RawType, const char*>) {
-        // C 字符串
-        return String(std::forward<T>(value));
-    } else if constexpr (std::is_same_v<RawType, char>) {
-        // 单个字符
-        return String(1, value);
+/// 每个线程复用的格式化缓冲区，通过 BorrowedFormatBuffer 使用
+inline auto format_buffer() -> String& {
+    thread_local String buffer;
+    return buffer;
+}
+
+/// 借用线程的格式化缓冲区，析构时归还。借用期间再次借用（如参数的 operator<< 中调用 print）
+/// 得到一个新的空缓冲区，不会互相覆盖
+class BorrowedFormatBuffer {
+    String buffer_;
+
+public:
+    BorrowedFormatBuffer() : buffer_(std::move(format_buffer())) { buffer_.clear(); }
+    ~BorrowedFormatBuffer() { format_buffer() = std::move(buffer_); }
+
+    BorrowedFormatBuffer(const BorrowedFormatBuffer&) = delete;
+    auto operator=(const BorrowedFormatBuffer&) -> BorrowedFormatBuffer& = delete;
+
+    auto get() -> String& { return buffer_; }
+};
+
+/// 取出 back_insert_iterator 指向的容器（标准规定的受保护成员 container）
+template<typename Container>
+auto back_insert_container(std::back_insert_iterator<Container>& it) -> Container& {
+    struct Access : std::back_insert_iterator<Container> {
+        static auto get(std::back_insert_iterator<Container>& it) -> Container& { return *(it.*&Access::container); }
+    };
+    return Access::get(it);
+}
+
+/// 接管 out 的缓冲区，在末尾追加格式化结果。格式和参数都不能指向 out 的内容
+template<typename Format, typename... Args>
+auto append_formatted(String& out, const Format& fmt, const Args&... args) -> void {
+    StringBuilder builder(std::move(out));
+    builder.append_fmt(fmt, args...);
+    out = builder.finish();
+}
+
+/// 编译期格式的文本是静态的，算术参数按值读取，此时都不可能指向目标字符串
+template<typename Format, typename... Args>
+inline constexpr bool FORMAT_CANNOT_ALIAS = IS_COMPILED_FORMAT<Format> && (std::is_arithmetic_v<Args> && ...);
+
+template<typename OutputIt, typename Format, typename... Args>
+auto format_to_impl(OutputIt out, const Format& fmt, const Args&... args) -> OutputIt {
+    if constexpr (std::is_same_v<OutputIt, std::back_insert_iterator<String>>) {
+        String& target = back_insert_container(out);
+        if constexpr (FORMAT_CANNOT_ALIAS<Format, Args...>) {
+            // 直接在目标字符串的缓冲区上追加，不经过中间缓冲区
+            append_formatted(target, fmt, args...);
+        } else {
+            // 格式或参数可能指向目标字符串本身（如 format_to(std::back_inserter(s), "{}", s)），
+            // 先格式化到线程缓冲区，再一次追加
+            BorrowedFormatBuffer buffer;
+            append_formatted(buffer.get(), fmt, args...);
+            target.append(buffer.get().data(), buffer.get().len());
+        }
+        return out;
     } else {
-        // 其他类型尝试使用输出流（假设不抛出异常）
-        std::ostringstream oss;
-        oss << value;
-        return String(oss.str());
+        BorrowedFormatBuffer buffer;
+        append_formatted(buffer.get(), fmt, args...);
+        return std::copy_n(buffer.get().data(), buffer.get().len(), out);
     }
 }
 
+template<typename Format, typename... Args>
+auto formatted_size_impl(const Format& fmt, const Args&... args) -> std::size_t {
+    BorrowedFormatBuffer buffer;
+    append_formatted(buffer.get(), fmt, args...);
+    return buffer.get().len();
+}
+
 } // namespace detail
 
-/// 内部格式化函数：将格式字符串 fmt 中的 {} 依次替换为 args 的字符串表示
+// ==================== 格式化到已有的输出 ====================
+// 语法见 format.hpp。写入 std::back_inserter(String) 时，KS_FMT 格式且参数都是算术类型则直接在目标字符串的缓冲区上追加；
+// 其余情况（参数可以是目标字符串本身）和其他输出先在线程复用的缓冲区中格式化再拷贝，
+// 缓冲区预热后不再分配内存，适合在循环中反复使用：
+//     char line[64];
+//     auto result = format_to_n(line, sizeof(line), KS_FMT("{:>8.2f}"), x);
+// 格式错误或参数数量不符时终止程序（KS_FMT 在编译期检查）
+
+/// format_to_n 的返回值
+template<typename OutputIt>
+struct FormatToNResult {
+    OutputIt out;       // 写入内容之后的位置
+    std::size_t size;   // 完整结果的字节数，可能大于 n
+};
+
+namespace detail {
+
+template<typename OutputIt, typename Format, typename... Args>
+auto format_to_n_impl(OutputIt out, std::size_t n, const Format& fmt, const Args&... args) {
+    BorrowedFormatBuffer buffer;
+    append_formatted(buffer.get(), fmt, args...);
+    const String& text = buffer.get();
+    return FormatToNResult<OutputIt>{std::copy_n(text.data(), std::min(n, text.len()), out), text.len()};
+}
+
+} // namespace detail
+
+/// 把格式化结果写入 out，返回写入内容之后的位置
+template<typename OutputIt, typename... Args>
+auto format_to(OutputIt out, StringView fmt, const Args&... args) -> OutputIt {
+    return detail::format_to_impl(out, fmt, args...);
+}
+
+template<typename OutputIt, typename F, typename... Args, typename = std::enable_if_t<detail::IS_COMPILED_FORMAT<F>>>
+auto format_to(OutputIt out, F fmt, const Args&... args) -> OutputIt {
+    return detail::format_to_impl(out, fmt, args...);
+}
+
+/// 最多写入 n 个字节（可能截断 UTF-8 字符），不写结尾的 '\0'
+template<typename OutputIt, typename... Args>
+auto format_to_n(OutputIt out, std::size_t n, StringView fmt, const Args&... args) -> FormatToNResult<OutputIt> {
+    return detail::format_to_n_impl(out, n, fmt, args...);
+}
+
+template<typename OutputIt, typename F, typename... Args, typename = std::enable_if_t<detail::IS_COMPILED_FORMAT<F>>>
+auto format_to_n(OutputIt out, std::size_t n, F fmt, const Args&... args) -> FormatToNResult<OutputIt> {
+    return detail::format_to_n_impl(out, n, fmt, args...);
+}
+
+/// 格式化结果的字节数，可用于预先分配缓冲区
+template<typename... Args>
+auto formatted_size(StringView fmt, const Args&... args) -> std::size_t {
+    return detail::formatted_size_impl(fmt, args...);
+}
+
+template<typename F, typename... Args, typename = std::enable_if_t<detail::IS_COMPILED_FORMAT<F>>>
+auto formatted_size(F fmt, const Args&... args) -> std::size_t {
+    return detail::formatted_size_impl(fmt, args...);
+}
+
+/// 内部格式化函数：按 fmt 把 args 直接写入输出缓冲区，支持宽度、对齐、精度、进制等格式说明（语法见 format.hpp）
 template<typename... Args>
 auto format_to_string(const String& fmt, Args&&... args) -> String {
-    std::array<String, sizeof...(args)> arg_strings = {
-        detail::to_string_impl(std::forward<Args>(args))...
-    };
-    std::string result;
-    const char* f = fmt.c_str();
-    size_t f_len = fmt.len();
-    size_t arg_index = 0;
-
-    for (size_t i = 0; i < f_len; ) {
-        if (f[i] == '{') {
-            if (i + 1 < f_len && f[i + 1] == '{') {
-                result += '{';
-                i += 2;
-                continue;
-            } else if (i + 1 < f_len && f[i + 1] == '}') {
-                ks::check(arg_index < arg_strings.size(),
-                          "format error: too few arguments");
-                result.append(arg_strings[arg_index].c_str(),
-                              arg_strings[arg_index].len());
-                ++arg_index;
-                i += 2;
-                continue;
-            }
-        } else if (f[i] == '}') {
-            if (i + 1 < f_len && f[i + 1] == '}') {
-                result += '}';
-                i += 2;
-                continue;
-            }
-        }
-        result += f[i];
-        ++i;
-    }
+    String out;
+    out.reserve(fmt.len());
+    detail::append_formatted(out, StringView(fmt), args...);
+    return out;
+}
+
+/// 按 KS_FMT 编译期解析好的格式生成字符串，参数数量不符时编译失败
+template<typename F, typename... Args, typename = std::enable_if_t<detail::IS_COMPILED_FORMAT<F>>>
+auto format_to_string(F fmt, const Args&... args) -> String {
+    String out;
+    detail::append_formatted(out, fmt, args...);
+    return out;
+}
+
+namespace detail {
+
+/// 在线程的格式化缓冲区中格式化，连同换行（newline 为 true 时）一起交给 output 一次写出
+template<typename Output, typename Format, typename... Args>
+auto print_formatted(Output&& output, bool newline, const Format& fmt, const Args&... args) -> void {
+    BorrowedFormatBuffer buffer;
+    append_formatted(buffer.get(), fmt, args...);
+    if (newline) buffer.get().push_back('\n');
+    output(buffer.get().view());
+}
+
+/// 写到标准输出：每行只调用一次 fwrite，多线程输出时行不会交错
+template<typename Format, typename... Args>
+auto print_stdout(bool newline, const Format& fmt, const Args&... args) -> void {
+    print_formatted([](std::string_view text) { std::fwrite(text.data(), 1, text.size(), stdout); },
+                    newline, fmt, args...);
+}
 
-    ks::check(arg_index == arg_strings.size(),
-              "format error: too many arguments");
-    return String(std::move(result));
+template<typename Format, typename... Args>
+auto print_sink(Sink& sink, bool newline, const Format& fmt, const Args&... args) -> void {
+    print_formatted([&sink](std::string_view text) { sink.write(text.data(), text.size()); }, newline, fmt, args...);
 }
 
+} // namespace detail
+
 /// 打印格式化字符串到标准输出
 template<typename... Args>
 auto print(const String& fmt, Args&&... args) -> void {
-    String output = format_to_string(fmt, std::forward<Args>(args)...);
-    std::fwrite(output.c_str(), 1, output.len(), stdout);
+    detail::print_stdout(false, StringView(fmt), args...);
 }
 
-/// 打印格式化字符串并换行
+/// 打印格式化字符串并换行，文本和换行一次写出
 template<typename... Args>
 auto println(const String& fmt, Args&&... args) -> void {
-    print(fmt, std::forward<Args>(args)...);
-    std::fwrite("\n", 1, 1, stdout);
+    detail::print_stdout(true, StringView(fmt), args...);
 }
 
 /// 重载：接受 C 字符串格式
 template<typename... Args>
 auto print(const char* fmt, Args&&... args) -> void {
-    print(String(fmt), std::forward<Args>(args)...);
+    detail::print_stdout(false, StringView(fmt), args...);
 }
 
 /// 重载：接受 C 字符串格式并换行
 template<typename... Args>
 auto println(const char* fmt, Args&&... args) -> void {
-    println(String(fmt), std::forward<Args>(args)...);
+    detail::print_stdout(true, StringView(fmt), args...);
+}
+
+/// 重载：KS_FMT 编译期格式，参数直接写入线程复用的缓冲区，不产生临时字符串
+template<typename F, typename... Args, typename = std::enable_if_t<detail::IS_COMPILED_FORMAT<F>>>
+auto print(F fmt, const Args&... args) -> void {
+    detail::print_stdout(false, fmt, args...);
+}
+
+/// 重载：KS_FMT 编译期格式并换行，文本和换行一次写出
+template<typename F, typename... Args, typename = std::enable_if_t<detail::IS_COMPILED_FORMAT<F>>>
+auto println(F fmt, const Args&... args) -> void {
+    detail::print_stdout(true, fmt, args...);
+}
+
+// ---------- 写入 Sink ----------
+// 在线程复用的缓冲区中格式化后整段交给 sink，不生成 String；一次 println 的内容不会与其他线程交错
+
+template<typename... Args>
+auto print(Sink& sink, StringView fmt, const Args&... args) -> void {
+    detail::print_sink(sink, false, fmt, args...);
+}
+
+template<typename... Args>
+auto println(Sink& sink, StringView fmt, const Args&... args) -> void {
+    detail::print_sink(sink, true, fmt, args...);
+}
+
+template<typename F, typename... Args, typename = std::enable_if_t<detail::IS_COMPILED_FORMAT<F>>>
+auto print(Sink& sink, F fmt, const Args&... args) -> void {
+    detail::print_sink(sink, false, fmt, args...);
+}
+
+template<typename F, typename... Args, typename = std::enable_if_t<detail::IS_COMPILED_FORMAT<F>>>
+auto println(Sink& sink, F fmt, const Args&... args) -> void {
+    detail::print_sink(sink, true, fmt, args...);
 }
 
-} // namespace ks
\ No newline at end of file
+} // namespace ks
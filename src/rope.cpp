@@ -0,0 +1,422 @@
+#include "rope.hpp"
+#include "search.hpp"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace ks {
+
+namespace detail {
+
+struct RopeNode {
+    std::shared_ptr<const RopeNode> left;
+    std::shared_ptr<const RopeNode> right;
+    String text;            // 只有叶子使用
+    std::size_t length;
+    std::size_t newlines;   // 子树中 '\n' 的个数
+    int height;             // 叶子为 0
+
+    auto is_leaf() const -> bool { return height == 0; }
+};
+
+} // namespace detail
+
+namespace {
+
+using Node = detail::RopeNode;
+using NodePtr = std::shared_ptr<const Node>;
+using SizeType = std::size_t;
+
+auto count_newlines(const char* data, SizeType len) -> SizeType {
+    SizeType count = 0;
+    const char* end = data + len;
+    while ((data = (const char*)std::memchr(data, '\n', (SizeType)(end - data))) != nullptr) {
+        ++count;
+        ++data;
+    }
+    return count;
+}
+
+auto height(const NodePtr& node) -> int {
+    return node ? node->height : -1;
+}
+
+auto make_leaf(StringView text) -> NodePtr {
+    if (text.empty()) return nullptr;
+    auto node = std::make_shared<Node>();
+    node->text = text.to_string();
+    node->length = text.len();
+    node->newlines = count_newlines(text.data(), text.len());
+    node->height = 0;
+    return node;
+}
+
+/// 直接组合两棵非空子树，不做平衡
+auto make_node(NodePtr left, NodePtr right) -> NodePtr {
+    auto node = std::make_shared<Node>();
+    node->length = left->length + right->length;
+    node->newlines = left->newlines + right->newlines;
+    node->height = std::max(left->height, right->height) + 1;
+    node->left = std::move(left);
+    node->right = std::move(right);
+    return node;
+}
+
+/// 组合高度差不超过 2 的两棵子树，必要时旋转
+auto balance(NodePtr left, NodePtr right) -> NodePtr {
+    int hl = height(left);
+    int hr = height(right);
+    if (hl > hr + 1) {
+        if (height(left->left) >= height(left->right)) {
+            return make_node(left->left, make_node(left->right, std::move(right)));
+        }
+        const NodePtr& mid = left->right;
+        return make_node(make_node(left->left, mid->left), make_node(mid->right, std::move(right)));
+    }
+    if (hr > hl + 1) {
+        if (height(right->right) >= height(right->left)) {
+            return make_node(make_node(std::move(left), right->left), right->right);
+        }
+        const NodePtr& mid = right->left;
+        return make_node(make_node(std::move(left), mid->left), make_node(mid->right, right->right));
+    }
+    return make_node(std::move(left), std::move(right));
+}
+
+/// 连接两棵平衡树，代价为 O(高度差)；相邻的小叶子合并为一个
+auto join(NodePtr left, NodePtr right) -> NodePtr {
+    if (!left) return right;
+    if (!right) return left;
+    if (left->is_leaf() && right->is_leaf() && left->length + right->length <= Rope::MAX_LEAF) {
+        String text;
+        text.reserve(left->length + right->length);
+        text.append(left->text).append(right->text);
+        return make_leaf(text);
+    }
+    if (left->height > right->height + 1) {
+        return balance(left->left, join(left->right, std::move(right)));
+    }
+    if (right->height > left->height + 1) {
+        return balance(join(std::move(left), right->left), right->right);
+    }
+    return make_node(std::move(left), std::move(right));
+}
+
+/// 在 pos 处把树分成 [0, pos) 和 [pos, len)
+auto split(const NodePtr& node, SizeType pos) -> std::pair<NodePtr, NodePtr> {
+    if (!node) return {nullptr, nullptr};
+    if (pos == 0) return {nullptr, node};
+    if (pos >= node->length) return {node, nullptr};
+    if (node->is_leaf()) {
+        StringView text(node->text);
+        return {make_leaf(text.substr(0, pos)), make_leaf(text.substr(pos))};
+    }
+    SizeType left_len = node->left->length;
+    if (pos <= left_len) {
+        auto [a, b] = split(node->left, pos);
+        return {std::move(a), join(std::move(b), node->right)};
+    }
+    auto [a, b] = split(node->right, pos - left_len);
+    return {join(node->left, std::move(a)), std::move(b)};
+}
+
+/// 把不超过 MAX_LEAF 的文本插入到 pos 处：只复制一条路径，叶子放不下时一分为二
+auto insert_small(const NodePtr& node, SizeType pos, StringView text) -> NodePtr {
+    if (node->is_leaf()) {
+        StringView old(node->text);
+        String merged;
+        merged.reserve(old.len() + text.len());
+        merged.append(old.data(), pos).append(text.data(), text.len()).append(old.data() + pos, old.len() - pos);
+        if (merged.len() <= Rope::MAX_LEAF) return make_leaf(merged);
+        SizeType half = merged.len() / 2;
+        StringView all(merged);
+        return make_node(make_leaf(all.substr(0, half)), make_leaf(all.substr(half)));
+    }
+    SizeType left_len = node->left->length;
+    if (pos <= left_len) {
+        return balance(insert_small(node->left, pos, text), node->right);
+    }
+    return balance(node->left, insert_small(node->right, pos - left_len, text));
+}
+
+/// 由连续文本自底向上构建完全平衡的树
+auto build(const std::vector<NodePtr>& leaves, SizeType lo, SizeType hi) -> NodePtr {
+    if (hi - lo == 1) return leaves[lo];
+    SizeType mid = lo + (hi - lo) / 2;
+    return make_node(build(leaves, lo, mid), build(leaves, mid, hi));
+}
+
+auto build(StringView text) -> NodePtr {
+    if (text.empty()) return nullptr;
+    std::vector<NodePtr> leaves;
+    leaves.reserve(text.len() / Rope::MAX_LEAF + 1);
+    for (SizeType pos = 0; pos < text.len(); pos += Rope::MAX_LEAF) {
+        leaves.push_back(make_leaf(text.substr(pos, Rope::MAX_LEAF)));
+    }
+    return build(leaves, 0, leaves.size());
+}
+
+template<typename F>
+auto visit_chunks(const NodePtr& node, SizeType offset, SizeType start, SizeType end, F& fn) -> bool {
+    if (!node || end <= offset || start >= offset + node->length) return true;
+    if (node->is_leaf()) {
+        SizeType from = start > offset ? start - offset : 0;
+        SizeType to = std::min(end - offset, node->length);
+        return fn(node->text.c_str() + from, to - from, offset + from);
+    }
+    if (!visit_chunks(node->left, offset, start, end, fn)) return false;
+    return visit_chunks(node->right, offset + node->left->length, start, end, fn);
+}
+
+} // namespace
+
+template<typename F>
+auto Rope::for_each_chunk(SizeType start, SizeType end, F&& fn) const -> void {
+    visit_chunks(root_, 0, start, end, fn);
+}
+
+// ==================== 构造 / 容量 ====================
+
+Rope::Rope(StringView text) : root_(build(text)) {}
+
+auto Rope::len() const -> SizeType {
+    return root_ ? root_->length : 0;
+}
+
+auto Rope::depth() const -> SizeType {
+    return root_ ? (SizeType)root_->height : 0;
+}
+
+auto Rope::operator[](SizeType index) const -> char {
+    const Node* node = root_.get();
+    while (!node->is_leaf()) {
+        if (index < node->left->length) {
+            node = node->left.get();
+        } else {
+            index -= node->left->length;
+            node = node->right.get();
+        }
+    }
+    return node->text[index];
+}
+
+// ==================== 修改器 ====================
+
+auto Rope::insert(SizeType pos, StringView text) -> Rope& {
+    if (text.empty()) return *this;
+    pos = std::min(pos, len());
+    if (root_ && text.len() <= MAX_LEAF) {
+        root_ = insert_small(root_, pos, text);
+    } else {
+        auto [a, b] = split(root_, pos);
+        root_ = join(join(std::move(a), build(text)), std::move(b));
+    }
+    return *this;
+}
+
+auto Rope::insert(SizeType pos, const Rope& other) -> Rope& {
+    auto [a, b] = split(root_, std::min(pos, len()));
+    root_ = join(join(std::move(a), other.root_), std::move(b));
+    return *this;
+}
+
+auto Rope::erase(SizeType pos, SizeType count) -> Rope& {
+    SizeType size = len();
+    if (pos >= size || count == 0) return *this;
+    count = std::min(count, size - pos);
+    auto [a, rest] = split(root_, pos);
+    auto [removed, b] = split(rest, count);
+    root_ = join(std::move(a), std::move(b));
+    return *this;
+}
+
+auto Rope::append(StringView text) -> Rope& {
+    return insert(len(), text);
+}
+
+auto Rope::append(const Rope& other) -> Rope& {
+    root_ = join(root_, other.root_);
+    return *this;
+}
+
+auto Rope::substr(SizeType pos, SizeType count) const -> Rope {
+    SizeType size = len();
+    if (pos >= size) return Rope();
+    count = std::min(count, size - pos);
+    auto [a, rest] = split(root_, pos);
+    return Rope(split(rest, count).first);
+}
+
+// ==================== 转换 ====================
+
+auto Rope::to_string() const -> String {
+    return to_string(0, len());
+}
+
+auto Rope::to_string(SizeType pos, SizeType count) const -> String {
+    SizeType size = len();
+    if (pos >= size) return String();
+    SizeType end = count > size - pos ? size : pos + count;
+    String result;
+    result.reserve(end - pos);
+    for_each_chunk(pos, end, [&](const char* data, SizeType n, SizeType) {
+        result.append(data, n);
+        return true;
+    });
+    return result;
+}
+
+auto Rope::operator==(const Rope& other) const -> bool {
+    if (len() != other.len()) return false;
+    if (root_ == other.root_) return true;
+    // 逐块比较：对方的内容按需取出
+    bool equal = true;
+    for_each_chunk(0, len(), [&](const char* data, SizeType n, SizeType pos) {
+        equal = other.to_string(pos, n).view() == std::string_view(data, n);
+        return equal;
+    });
+    return equal;
+}
+
+// ==================== 行 ====================
+
+auto Rope::line_count() const -> SizeType {
+    return (root_ ? root_->newlines : 0) + 1;
+}
+
+auto Rope::line_start(SizeType line) const -> SizeType {
+    if (line == 0) return 0;
+    if (line >= line_count()) return len();
+    // 找第 line 个 '\n'（从 1 计数），行从它之后开始
+    SizeType remaining = line;
+    SizeType offset = 0;
+    const Node* node = root_.get();
+    while (!node->is_leaf()) {
+        if (remaining <= node->left->newlines) {
+            node = node->left.get();
+        } else {
+            remaining -= node->left->newlines;
+            offset += node->left->length;
+            node = node->right.get();
+        }
+    }
+    const char* data = node->text.c_str();
+    const char* p = data;
+    for (;;) {
+        p = (const char*)std::memchr(p, '\n', node->length - (SizeType)(p - data));
+        if (--remaining == 0) break;
+        ++p;
+    }
+    return offset + (SizeType)(p - data) + 1;
+}
+
+auto Rope::line_of(SizeType pos) const -> SizeType {
+    pos = std::min(pos, len());
+    SizeType line = 0;
+    const Node* node = root_.get();
+    if (!node) return 0;
+    while (!node->is_leaf()) {
+        if (pos <= node->left->length) {
+            node = node->left.get();
+        } else {
+            pos -= node->left->length;
+            line += node->left->newlines;
+            node = node->right.get();
+        }
+    }
+    return line + count_newlines(node->text.c_str(), pos);
+}
+
+auto Rope::line(SizeType line) const -> String {
+    if (line >= line_count()) return String();
+    SizeType start = line_start(line);
+    SizeType end = line + 1 < line_count() ? line_start(line + 1) - 1 : len();
+    if (end > start && (*this)[end - 1] == '\r') --end;
+    return to_string(start, end - start);
+}
+
+// ==================== 查找 ====================
+
+auto Rope::find(StringView sub, SizeType start) const -> std::int64_t {
+    SizeType size = len();
+    SizeType m = sub.len();
+    if (start > size || m > size - start) return -1;
+    if (m == 0) return (std::int64_t)start;
+    // tail 保存已扫描文本的最后 m - 1 个字节，用来查找跨越块边界的匹配
+    String tail;
+    String window;
+    std::int64_t result = -1;
+    for_each_chunk(start, size, [&](const char* data, SizeType n, SizeType pos) {
+        if (!tail.empty()) {
+            window.assign(tail.data(), tail.len());
+            window.append(data, std::min(n, m - 1));
+            SizeType found = detail::search_find(window.data(), window.len(), sub.data(), m);
+            if (found != StringView::npos) {
+                result = (std::int64_t)(pos - tail.len() + found);
+                return false;
+            }
+        }
+        SizeType found = detail::search_find(data, n, sub.data(), m);
+        if (found != StringView::npos) {
+            result = (std::int64_t)(pos + found);
+            return false;
+        }
+        if (n >= m - 1) {
+            tail.assign(data + n - (m - 1), m - 1);
+        } else {
+            tail.append(data, n);
+            if (tail.len() > m - 1) tail.erase(0, tail.len() - (m - 1));
+        }
+        return true;
+    });
+    return result;
+}
+
+auto Rope::rfind(StringView sub) const -> std::int64_t {
+    SizeType size = len();
+    SizeType m = sub.len();
+    if (m > size) return -1;
+    if (m == 0) return (std::int64_t)size;
+    // 从右往左逐块查找，head 保存已扫描文本的最前 m - 1 个字节
+    std::vector<std::pair<const char*, SizeType>> chunks;
+    for_each_chunk(0, size, [&](const char* data, SizeType n, SizeType) {
+        chunks.emplace_back(data, n);
+        return true;
+    });
+    String head;
+    String window;
+    SizeType pos = size;
+    for (auto it = chunks.rbegin(); it != chunks.rend(); ++it) {
+        auto [data, n] = *it;
+        pos -= n;
+        if (!head.empty()) {
+            SizeType take = std::min(n, m - 1);
+            window.assign(data + n - take, take);
+            window.append(head);
+            SizeType found = detail::search_rfind(window.data(), window.len(), sub.data(), m);
+            if (found != StringView::npos) return (std::int64_t)(pos + n - take + found);
+        }
+        SizeType found = detail::search_rfind(data, n, sub.data(), m);
+        if (found != StringView::npos) return (std::int64_t)(pos + found);
+        if (n >= m - 1) {
+            head.assign(data, m - 1);
+        } else {
+            head.insert(0, String(data, n));
+            head.resize(std::min(head.len(), m - 1));
+        }
+    }
+    return -1;
+}
+
+auto Rope::count(StringView sub) const -> SizeType {
+    if (sub.empty()) return 0;
+    SizeType result = 0;
+    std::int64_t pos = find(sub, 0);
+    while (pos >= 0) {
+        ++result;
+        pos = find(sub, (SizeType)pos + sub.len());
+    }
+    return result;
+}
+
+} // namespace ks
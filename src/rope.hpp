@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "string.hpp"
+#include "string_view.hpp"
+
+namespace ks {
+
+namespace detail {
+
+/// Rope 的树节点，定义在 rope.cpp
+struct RopeNode;
+
+} // namespace detail
+
+/// 适合大文本频繁编辑的字符串：不可变节点组成的 AVL 平衡树，文本存放在叶子上。
+/// insert、erase、substr 和按下标访问都是 O(log n)；修改只复制根到叶子路径上的节点，
+/// 其余节点与旧版本共享，因此拷贝（快照）是 O(1) 的，旧快照不受之后修改的影响。
+/// 每个节点记录子树中的换行符个数，按行定位同样是 O(log n)。
+/// 节点使用原子引用计数，不同线程可以各自持有和修改同一 Rope 的快照
+class Rope {
+public:
+    using SizeType = std::size_t;
+
+    static constexpr SizeType npos = static_cast<SizeType>(-1);
+
+    /// 叶子的最大字节数
+    static constexpr SizeType MAX_LEAF = 1024;
+
+    // 构造函数
+    Rope() = default;
+    explicit Rope(StringView text);
+    Rope(const Rope& other) = default;
+    Rope(Rope&& other) noexcept = default;
+
+    auto operator=(const Rope& other) -> Rope& = default;
+    auto operator=(Rope&& other) noexcept -> Rope& = default;
+
+    // 容量
+    auto len() const -> SizeType;
+    auto empty() const -> bool { return len() == 0; }
+
+    /// 树高，空 Rope 和只有一个叶子时为 0
+    auto depth() const -> SizeType;
+
+    // 访问
+    auto operator[](SizeType index) const -> char;
+
+    // 修改器（pos 超过长度时按长度处理）
+    auto insert(SizeType pos, StringView text) -> Rope&;
+    auto insert(SizeType pos, const Rope& other) -> Rope&;
+    auto erase(SizeType pos, SizeType count = 1) -> Rope&;
+    auto append(StringView text) -> Rope&;
+    auto append(const Rope& other) -> Rope&;
+    auto clear() -> void { root_.reset(); }
+
+    /// 子串，与原 Rope 共享节点
+    auto substr(SizeType pos, SizeType count = npos) const -> Rope;
+
+    // 转换
+    auto to_string() const -> String;
+    auto to_string(SizeType pos, SizeType count) const -> String;
+
+    // ---------- 行 ----------
+    // 以 '\n' 分行，行数为换行符个数 + 1；取出的行不含行尾的 '\n'（以及其前的 '\r'）
+
+    auto line_count() const -> SizeType;
+
+    /// 第 line 行的起始下标，line 超出范围时返回 len()
+    auto line_start(SizeType line) const -> SizeType;
+
+    /// 下标 pos 所在的行号
+    auto line_of(SizeType pos) const -> SizeType;
+
+    auto line(SizeType line) const -> String;
+
+    // ---------- 查找 ----------
+    // 跨叶子边界的匹配同样能找到
+
+    /// 从 start 开始查找子串，返回索引，没找到返回 -1
+    auto find(StringView sub, SizeType start = 0) const -> std::int64_t;
+
+    /// 从右查找子串
+    auto rfind(StringView sub) const -> std::int64_t;
+
+    /// 子串不重叠出现的次数
+    auto count(StringView sub) const -> SizeType;
+
+    auto operator==(const Rope& other) const -> bool;
+    auto operator!=(const Rope& other) const -> bool { return !(*this == other); }
+
+private:
+    using NodePtr = std::shared_ptr<const detail::RopeNode>;
+
+    NodePtr root_;
+
+    explicit Rope(NodePtr root) : root_(std::move(root)) {}
+
+    /// 依次对 [start, end) 覆盖的每段叶子文本调用 fn(data, size, pos)，fn 返回 false 时停止
+    template<typename F>
+    auto for_each_chunk(SizeType start, SizeType end, F&& fn) const -> void;
+};
+
+} // namespace ks
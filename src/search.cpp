@@ -0,0 +1,335 @@
+#include "search.hpp"
+#include "bits.hpp"
+#include <cstring>
+#include <string_view>
+
+#if !defined(KS_DISABLE_SIMD) && (defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__)))
+    #define KS_SEARCH_SSE2 1
+    #include <emmintrin.h>
+    #if defined(__GNUC__)
+        #define KS_SEARCH_AVX2 1
+        #define KS_TARGET_AVX2 __attribute__((target("avx2")))
+        #include <immintrin.h>
+    #endif
+#endif
+
+namespace ks {
+namespace detail {
+
+namespace {
+
+constexpr std::size_t NPOS = StringView::npos;
+
+// ==================== 标量实现 ====================
+
+inline auto std_find(const char* hay, std::size_t n, const char* needle, std::size_t m, std::size_t start)
+    -> std::size_t {
+    return std::string_view(hay, n).find(std::string_view(needle, m), start);
+}
+
+inline auto std_rfind(const char* hay, std::size_t n, const char* needle, std::size_t m) -> std::size_t {
+    return std::string_view(hay, n).rfind(std::string_view(needle, m));
+}
+
+/// 检查候选位置 i 的中间部分（首尾字节已经匹配）
+inline auto middle_equal(const char* hay, std::size_t i, const char* needle, std::size_t m) -> bool {
+    return m <= 2 || std::memcmp(hay + i + 1, needle + 1, m - 2) == 0;
+}
+
+#ifdef KS_SEARCH_SSE2
+
+// ==================== SSE2 首尾字节过滤 ====================
+// 一次比较 16 个候选起点：起点处的字节等于模式串首字节、且起点 + m - 1 处的字节等于尾字节时，
+// 才对中间部分做 memcmp。调用方保证 2 <= m <= n
+
+auto sse2_first_last_find(const char* hay, std::size_t n, const char* needle, std::size_t m, std::size_t start)
+    -> std::size_t {
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[m - 1]);
+    std::size_t candidates = n - m + 1;  // 合法起点为 [0, candidates)
+    std::size_t i = start;
+    for (; i + 16 <= candidates; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(hay + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(hay + i + m - 1));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+        while (mask != 0) {
+            unsigned bit = lowest_bit(mask);
+            if (middle_equal(hay, i + bit, needle, m)) return i + bit;
+            mask &= mask - 1;
+        }
+    }
+    for (; i < candidates; ++i) {
+        if (hay[i] == needle[0] && hay[i + m - 1] == needle[m - 1] && middle_equal(hay, i, needle, m)) return i;
+    }
+    return NPOS;
+}
+
+auto sse2_first_last_rfind(const char* hay, std::size_t n, const char* needle, std::size_t m) -> std::size_t {
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[m - 1]);
+    std::size_t end = n - m + 1;  // 尚未检查的起点为 [0, end)
+    while (end >= 16) {
+        std::size_t base = end - 16;
+        __m128i a = _mm_loadu_si128((const __m128i*)(hay + base));
+        __m128i b = _mm_loadu_si128((const __m128i*)(hay + base + m - 1));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+        while (mask != 0) {
+            unsigned bit = highest_bit(mask);
+            if (middle_equal(hay, base + bit, needle, m)) return base + bit;
+            mask &= ~(1u << bit);
+        }
+        end = base;
+    }
+    while (end > 0) {
+        --end;
+        if (hay[end] == needle[0] && hay[end + m - 1] == needle[m - 1] && middle_equal(hay, end, needle, m)) {
+            return end;
+        }
+    }
+    return NPOS;
+}
+
+#endif
+
+#ifdef KS_SEARCH_AVX2
+
+// ==================== AVX2 首尾字节过滤 ====================
+
+KS_TARGET_AVX2 auto avx2_first_last_find(const char* hay, std::size_t n, const char* needle, std::size_t m,
+                                         std::size_t start) -> std::size_t {
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[m - 1]);
+    std::size_t candidates = n - m + 1;
+    std::size_t i = start;
+    for (; i + 32 <= candidates; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(hay + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(hay + i + m - 1));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+        while (mask != 0) {
+            unsigned bit = lowest_bit(mask);
+            if (middle_equal(hay, i + bit, needle, m)) return i + bit;
+            mask &= mask - 1;
+        }
+    }
+    return sse2_first_last_find(hay, n, needle, m, i);
+}
+
+KS_TARGET_AVX2 auto avx2_first_last_rfind(const char* hay, std::size_t n, const char* needle, std::size_t m)
+    -> std::size_t {
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[m - 1]);
+    std::size_t end = n - m + 1;
+    while (end >= 32) {
+        std::size_t base = end - 32;
+        __m256i a = _mm256_loadu_si256((const __m256i*)(hay + base));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(hay + base + m - 1));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+        while (mask != 0) {
+            unsigned bit = highest_bit(mask);
+            if (middle_equal(hay, base + bit, needle, m)) return base + bit;
+            mask &= ~(1u << bit);
+        }
+        end = base;
+    }
+    // 剩余的起点都在 [0, end) 内，等价于在前 end + m - 1 个字节中从右查找
+    return sse2_first_last_rfind(hay, end + m - 1, needle, m);
+}
+
+#endif
+
+// ==================== 运行时分派 ====================
+
+struct SearchKernels {
+    std::size_t (*find)(const char*, std::size_t, const char*, std::size_t, std::size_t);
+    std::size_t (*rfind)(const char*, std::size_t, const char*, std::size_t);
+};
+
+auto select_kernels() -> SearchKernels {
+#ifdef KS_SEARCH_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return {avx2_first_last_find, avx2_first_last_rfind};
+    }
+#endif
+#ifdef KS_SEARCH_SSE2
+    return {sse2_first_last_find, sse2_first_last_rfind};
+#else
+    return {std_find, std_rfind};
+#endif
+}
+
+auto kernels() -> const SearchKernels& {
+    static const SearchKernels selected = select_kernels();
+    return selected;
+}
+
+} // namespace
+
+// ==================== 查找原语 ====================
+
+auto horspool_table(const char* needle, std::size_t m, std::uint32_t* shift) -> void {
+    // 模式串超过 32 位范围时截断跳跃距离，跳得少一些仍然正确
+    auto full = (std::uint32_t)(m > 0xFFFFFFFFu ? 0xFFFFFFFFu : m);
+    for (int c = 0; c < 256; ++c) {
+        shift[c] = full;
+    }
+    for (std::size_t i = 0; i + 1 < m; ++i) {
+        std::size_t distance = m - 1 - i;
+        shift[(unsigned char)needle[i]] = (std::uint32_t)(distance > full ? full : distance);
+    }
+}
+
+auto horspool_find(const char* hay, std::size_t n, const char* needle, std::size_t m, std::size_t start,
+                   const std::uint32_t* shift) -> std::size_t {
+    if (m == 0) return start <= n ? start : NPOS;
+    if (m > n) return NPOS;
+    const char last = needle[m - 1];
+    std::size_t i = start;
+    while (i <= n - m) {
+        char c = hay[i + m - 1];
+        if (c == last && std::memcmp(hay + i, needle, m - 1) == 0) return i;
+        i += shift[(unsigned char)c];
+    }
+    return NPOS;
+}
+
+auto first_last_find(const char* hay, std::size_t n, const char* needle, std::size_t m, std::size_t start)
+    -> std::size_t {
+    if (m < 2 || m > n || start > n - m) return std_find(hay, n, needle, m, start);
+    return kernels().find(hay, n, needle, m, start);
+}
+
+auto first_last_rfind(const char* hay, std::size_t n, const char* needle, std::size_t m) -> std::size_t {
+    if (m < 2 || m > n) return std_rfind(hay, n, needle, m);
+    return kernels().rfind(hay, n, needle, m);
+}
+
+auto search_find(const char* hay, std::size_t n, const char* needle, std::size_t m, std::size_t start)
+    -> std::size_t {
+    if (m >= HORSPOOL_MIN_LEN && m <= n && start <= n - m) {
+        std::uint32_t shift[256];
+        horspool_table(needle, m, shift);
+        return horspool_find(hay, n, needle, m, start, shift);
+    }
+    // 单字节模式串由 std 实现（memchr）处理
+    return first_last_find(hay, n, needle, m, start);
+}
+
+auto search_rfind(const char* hay, std::size_t n, const char* needle, std::size_t m) -> std::size_t {
+    return first_last_rfind(hay, n, needle, m);
+}
+
+namespace {
+
+/// 不重叠出现的次数，find(start) 返回从 start 开始的下一个位置
+template<typename Find>
+auto count_matches(std::size_t m, Find&& find) -> std::size_t {
+    std::size_t count = 0;
+    for (std::size_t pos = 0; (pos = find(pos)) != NPOS; pos += m) {
+        ++count;
+    }
+    return count;
+}
+
+/// 把所有不重叠的出现替换为 replacement，find 同上
+template<typename Find>
+auto replace_matches(StringView haystack, std::size_t m, StringView replacement, Find&& find) -> String {
+    String result;
+    std::size_t pos = 0;
+    std::size_t found;
+    while ((found = find(pos)) != NPOS) {
+        result.append(haystack.data() + pos, found - pos);
+        result.append(replacement.data(), replacement.len());
+        pos = found + m;
+    }
+    result.append(haystack.data() + pos, haystack.len() - pos);
+    return result;
+}
+
+} // namespace
+
+auto search_count(StringView haystack, StringView needle) -> std::size_t {
+    const char* hay = haystack.data();
+    std::size_t n = haystack.len();
+    std::size_t m = needle.len();
+    if (m == 0 || m > n) return 0;
+    if (m >= HORSPOOL_MIN_LEN) {
+        std::uint32_t shift[256];
+        horspool_table(needle.data(), m, shift);
+        return count_matches(m, [&](std::size_t start) { return horspool_find(hay, n, needle.data(), m, start, shift); });
+    }
+    return count_matches(m, [&](std::size_t start) { return first_last_find(hay, n, needle.data(), m, start); });
+}
+
+auto search_replace(StringView haystack, StringView needle, StringView replacement) -> String {
+    const char* hay = haystack.data();
+    std::size_t n = haystack.len();
+    std::size_t m = needle.len();
+    if (m == 0 || m > n) return haystack.to_string();
+    if (m >= HORSPOOL_MIN_LEN) {
+        std::uint32_t shift[256];
+        horspool_table(needle.data(), m, shift);
+        return replace_matches(haystack, m, replacement, [&](std::size_t start) {
+            return horspool_find(hay, n, needle.data(), m, start, shift);
+        });
+    }
+    return replace_matches(haystack, m, replacement, [&](std::size_t start) {
+        return first_last_find(hay, n, needle.data(), m, start);
+    });
+}
+
+} // namespace detail
+
+// ==================== Searcher ====================
+
+Searcher::Searcher(StringView needle, SearchAlgorithm algorithm)
+    : needle_(needle.data(), needle.len()), algorithm_(algorithm) {
+    if (algorithm_ == SearchAlgorithm::Auto) {
+        algorithm_ = needle_.len() >= detail::HORSPOOL_MIN_LEN ? SearchAlgorithm::Horspool : SearchAlgorithm::FirstLast;
+    }
+    if (algorithm_ == SearchAlgorithm::Horspool) {
+        detail::horspool_table(needle_.data(), needle_.len(), shift_);
+    }
+}
+
+auto Searcher::find_pos(const char* hay, SizeType n, SizeType start) const -> SizeType {
+    switch (algorithm_) {
+        case SearchAlgorithm::Std:
+            return detail::std_find(hay, n, needle_.data(), needle_.len(), start);
+        case SearchAlgorithm::Horspool:
+            return detail::horspool_find(hay, n, needle_.data(), needle_.len(), start, shift_);
+        default:
+            return detail::first_last_find(hay, n, needle_.data(), needle_.len(), start);
+    }
+}
+
+auto Searcher::find(StringView haystack, SizeType start) const -> std::int64_t {
+    auto pos = find_pos(haystack.data(), haystack.len(), start);
+    return pos == StringView::npos ? -1 : (std::int64_t)pos;
+}
+
+auto Searcher::rfind(StringView haystack) const -> std::int64_t {
+    // 反向查找只有首尾字节过滤一种实现
+    auto pos = algorithm_ == SearchAlgorithm::Std
+        ? detail::std_rfind(haystack.data(), haystack.len(), needle_.data(), needle_.len())
+        : detail::first_last_rfind(haystack.data(), haystack.len(), needle_.data(), needle_.len());
+    return pos == StringView::npos ? -1 : (std::int64_t)pos;
+}
+
+auto Searcher::count(StringView haystack) const -> SizeType {
+    SizeType m = needle_.len();
+    if (m == 0) return 0;
+    return detail::count_matches(m, [&](SizeType start) { return find_pos(haystack.data(), haystack.len(), start); });
+}
+
+auto Searcher::replace(StringView haystack, StringView replacement) const -> String {
+    SizeType m = needle_.len();
+    if (m == 0) return haystack.to_string();
+    return detail::replace_matches(haystack, m, replacement, [&](SizeType start) {
+        return find_pos(haystack.data(), haystack.len(), start);
+    });
+}
+
+} // namespace ks
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "string.hpp"
+#include "string_view.hpp"
+
+namespace ks {
+
+/// 子串查找使用的算法
+enum class SearchAlgorithm {
+    Auto,       // 按模式串长度自动选择
+    Std,        // std::string_view::find，用作对照
+    FirstLast,  // SIMD 比较候选位置的首尾字节，命中后再比较中间部分，适合短模式串
+    Horspool,   // Boyer–Moore–Horspool，按坏字符表跳跃，适合长模式串
+};
+
+namespace detail {
+
+/// Auto 模式下模式串达到该长度时使用 Horspool
+constexpr std::size_t HORSPOOL_MIN_LEN = 32;
+
+/// 在 hay[0, n) 中从 start 开始查找 needle[0, m)，返回位置，没找到返回 StringView::npos。
+/// 一次性查找：长模式串临时构建跳跃表，短模式串使用 SIMD 首尾字节过滤
+auto search_find(const char* hay, std::size_t n, const char* needle, std::size_t m, std::size_t start = 0)
+    -> std::size_t;
+
+/// 从右查找，返回最后一次出现的位置，没找到返回 StringView::npos
+auto search_rfind(const char* hay, std::size_t n, const char* needle, std::size_t m) -> std::size_t;
+
+/// 一次性计数：不重叠出现的次数，空模式串返回 0。
+/// 不构造 Searcher，只有长模式串才构建跳跃表，且整个计数过程只构建一次
+auto search_count(StringView haystack, StringView needle) -> std::size_t;
+
+/// 一次性替换：把所有不重叠的出现替换为 replacement，空模式串时原样返回
+auto search_replace(StringView haystack, StringView needle, StringView replacement) -> String;
+
+/// 构建 Horspool 跳跃表
+auto horspool_table(const char* needle, std::size_t m, std::uint32_t* shift) -> void;
+
+auto horspool_find(const char* hay, std::size_t n, const char* needle, std::size_t m, std::size_t start,
+                   const std::uint32_t* shift) -> std::size_t;
+
+auto first_last_find(const char* hay, std::size_t n, const char* needle, std::size_t m, std::size_t start)
+    -> std::size_t;
+
+auto first_last_rfind(const char* hay, std::size_t n, const char* needle, std::size_t m) -> std::size_t;
+
+} // namespace detail
+
+/// 针对固定模式串预处理好的查找器，可在大量文本上重复使用以摊薄预处理开销。
+/// 模式串复制保存，构造后不再依赖传入的字符串
+class Searcher {
+    String needle_;
+    SearchAlgorithm algorithm_;
+    std::uint32_t shift_[256];  // Horspool 跳跃表，只在使用 Horspool 时构建
+
+public:
+    using SizeType = std::size_t;
+
+    explicit Searcher(StringView needle, SearchAlgorithm algorithm = SearchAlgorithm::Auto);
+
+    auto needle() const -> StringView { return needle_; }
+
+    /// 实际使用的算法（Auto 已被解析为具体算法）
+    auto algorithm() const -> SearchAlgorithm { return algorithm_; }
+
+    /// 从 start 开始查找，返回索引，没找到返回 -1
+    auto find(StringView haystack, SizeType start = 0) const -> std::int64_t;
+
+    /// 从右查找，返回索引，没找到返回 -1
+    auto rfind(StringView haystack) const -> std::int64_t;
+
+    /// 不重叠出现的次数，空模式串返回 0
+    auto count(StringView haystack) const -> SizeType;
+
+    /// 把所有不重叠的出现替换为 replacement，空模式串时原样返回
+    auto replace(StringView haystack, StringView replacement) const -> String;
+
+private:
+    auto find_pos(const char* hay, SizeType n, SizeType start) const -> SizeType;
+};
+
+} // namespace ks
@@ -0,0 +1,114 @@
+#include "sink.hpp"
+#include <cerrno>
+
+#ifdef _WIN32
+    #include <fcntl.h>
+    #include <io.h>
+    #include <sys/stat.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace ks {
+
+namespace {
+
+/// 写出全部内容，处理部分写入和被信号中断的情况
+auto write_all(int fd, const char* data, std::size_t len) -> bool {
+    while (len > 0) {
+#ifdef _WIN32
+        unsigned chunk = len > (1u << 30) ? (1u << 30) : (unsigned)len;
+        int n = _write(fd, data, chunk);
+#else
+        ssize_t n = ::write(fd, data, len);
+#endif
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += n;
+        len -= (std::size_t)n;
+    }
+    return true;
+}
+
+} // namespace
+
+Sink::Sink(int fd, FlushPolicy policy, SizeType capacity)
+    : fd_(fd), policy_(policy), capacity_(capacity > 0 ? capacity : 1) {}
+
+Sink::Sink(Sink&& other) noexcept
+    : fd_(other.fd_), owns_fd_(other.owns_fd_), failed_(other.failed_), policy_(other.policy_),
+      capacity_(other.capacity_), pending_(std::move(other.pending_)) {
+    other.fd_ = -1;
+    other.owns_fd_ = false;
+}
+
+Sink::~Sink() {
+    if (fd_ < 0) return;
+    flush_locked();
+    if (owns_fd_) {
+#ifdef _WIN32
+        _close(fd_);
+#else
+        ::close(fd_);
+#endif
+    }
+}
+
+auto Sink::open(const String& path, bool append, FlushPolicy policy, SizeType capacity) -> Result<Sink, String> {
+#ifdef _WIN32
+    int flags = _O_WRONLY | _O_CREAT | _O_BINARY | (append ? _O_APPEND : _O_TRUNC);
+    int fd = _open(path.c_str(), flags, _S_IREAD | _S_IWRITE);
+#else
+    int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC);
+    int fd = ::open(path.c_str(), flags, 0644);
+#endif
+    if (fd < 0) {
+        return err<Sink>("sink: cannot open file");
+    }
+    Sink sink(fd, policy, capacity);
+    sink.owns_fd_ = true;
+    return ok(std::move(sink));
+}
+
+auto Sink::write(const char* data, SizeType len) -> void {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (policy_ == FlushPolicy::Always || len >= capacity_) {
+        // 先写出缓冲区中较早的内容，保持顺序
+        flush_locked();
+        emit(data, len);
+        return;
+    }
+    if (pending_.capacity() < capacity_) pending_.reserve(capacity_);
+    pending_.append(data, len);
+    bool line_end = policy_ == FlushPolicy::Line && len > 0 && data[len - 1] == '\n';
+    if (line_end || pending_.len() >= capacity_) flush_locked();
+}
+
+auto Sink::write(StringView text) -> void {
+    write(text.data(), text.len());
+}
+
+auto Sink::flush() -> Result<void, String> {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flush_locked();
+    if (failed_) {
+        failed_ = false;
+        return err<void>("sink: write failed");
+    }
+    return ok();
+}
+
+auto Sink::emit(const char* data, SizeType len) -> void {
+    if (!write_all(fd_, data, len)) failed_ = true;
+}
+
+auto Sink::flush_locked() -> void {
+    if (pending_.empty()) return;
+    emit(pending_.data(), pending_.len());
+    pending_.clear();
+}
+
+} // namespace ks
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+
+#include "result.hpp"
+#include "string.hpp"
+
+namespace ks {
+
+/// 输出端的刷新策略
+enum class FlushPolicy {
+    Always,  // 每次写入都立即交给系统调用
+    Line,    // 写入的内容以换行结尾时刷新（默认，适合终端和日志）
+    Full,    // 缓冲区满、调用 flush() 或析构时刷新，适合写文件
+};
+
+/// 线程安全的输出端：用 write(2) 直接写文件描述符，不经过 stdio。
+/// 每次 write 的内容在缓冲区和系统调用中都是连续的，多个线程同时 println 时行不会交错。
+/// 配合 print / println 使用时，格式化在各线程自己的缓冲区中完成，持锁期间只有一次拷贝或一次系统调用
+class Sink {
+public:
+    using SizeType = std::size_t;
+
+    static constexpr SizeType DEFAULT_CAPACITY = 64 * 1024;
+
+    /// 写入已打开的文件描述符，不接管其所有权（如 1 为标准输出）。
+    /// 与 stdio 混用同一个描述符时，stdio 缓冲区中的内容可能晚于 Sink 写出
+    explicit Sink(int fd, FlushPolicy policy = FlushPolicy::Line, SizeType capacity = DEFAULT_CAPACITY);
+
+    /// 创建或打开文件，append 为 false 时清空原有内容；析构时关闭文件
+    static auto open(const String& path, bool append = false, FlushPolicy policy = FlushPolicy::Full,
+                     SizeType capacity = DEFAULT_CAPACITY) -> Result<Sink, String>;
+
+    Sink(const Sink& other) = delete;
+    auto operator=(const Sink& other) -> Sink& = delete;
+
+    /// 移动时不能有其他线程正在使用 other
+    Sink(Sink&& other) noexcept;
+
+    /// 刷新剩余内容，拥有描述符时关闭它
+    ~Sink();
+
+    /// 写入一段内容，按刷新策略决定是否立即写出；不小于缓冲区容量的内容不经过缓冲区
+    auto write(const char* data, SizeType len) -> void;
+    auto write(StringView text) -> void;
+
+    /// 写出缓冲区中的内容。上次 flush 以来任何一次写出失败都会返回错误
+    auto flush() -> Result<void, String>;
+
+    auto fd() const -> int { return fd_; }
+    auto policy() const -> FlushPolicy { return policy_; }
+
+private:
+    int fd_;
+    bool owns_fd_ = false;
+    bool failed_ = false;
+    FlushPolicy policy_;
+    SizeType capacity_;
+    String pending_;
+    std::mutex mutex_;
+
+    /// 以下函数要求已持有 mutex_
+    auto emit(const char* data, SizeType len) -> void;
+    auto flush_locked() -> void;
+};
+
+} // namespace ks
@@ -1,168 +1,272 @@
 #include "string.hpp"
+#include "ascii.hpp"
+#include "unicode.hpp"
+#include "search.hpp"
+#include "string_builder.hpp"
+#include "utf8.hpp"
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
-#include <cwchar>
-#include <codecvt>
-#include <locale>
 #include <vector>
 #include <sstream>
 #include <iomanip>
 
 namespace ks {
 
-// ==================== 构造函数和赋值 ====================
-
-String::String(const char* str) : data_(str ? str : "") {}
+// ==================== 内存管理 ====================
 
-String::String(const std::string& str) : data_(str) {}
+namespace {
 
-String::String(std::string&& str) noexcept : data_(std::move(str)) {}
+/// 分配失败时直接终止，与容器的其他失败路径保持一致（库内不使用异常）
+auto checked_realloc(char* ptr, std::size_t bytes) -> char* {
+    auto* result = (char*)std::realloc(ptr, bytes);
+    if (result == nullptr) {
+        std::fprintf(stderr, "ks::String: out of memory\n");
+        std::abort();
+    }
+    return result;
+}
 
-String::String(std::string_view sv) : data_(sv.data(), sv.size()) {}
+} // namespace
 
-String::String(SizeType count, char ch) : data_(count, ch) {}
+auto String::set_len(SizeType count) -> void {
+    if (is_inline()) {
+        inline_[count] = '\0';
+        inline_[INLINE_CAPACITY] = (char)(INLINE_CAPACITY - count);
+    } else {
+        heap_.size = count;
+        heap_.ptr[count] = '\0';
+    }
+}
 
-auto String::operator=(const char* str) -> String& {
-    data_ = str ? str : "";
-    return *this;
+auto String::grow(SizeType new_cap) -> void {
+    SizeType cap = capacity();
+    if (new_cap <= cap) return;
+    if (new_cap < cap * 2) new_cap = cap * 2;
+    if (is_inline()) {
+        SizeType count = len();
+        char* ptr = checked_realloc(nullptr, new_cap + 1);
+        std::memcpy(ptr, inline_, count + 1);
+        heap_.ptr = ptr;
+        heap_.size = count;
+    } else {
+        heap_.ptr = checked_realloc(heap_.ptr, new_cap + 1);
+    }
+    heap_.capacity = (std::uint64_t)new_cap | HEAP_FLAG;
 }
 
-auto String::operator=(const std::string& str) -> String& {
-    data_ = str;
-    return *this;
+auto String::release() -> void {
+    if (!is_inline()) std::free(heap_.ptr);
 }
 
-// ==================== 转换函数 ====================
+// ==================== 构造函数和赋值 ====================
 
-auto String::to_std_string() const -> std::string {
-    return data_;
+String::String(const char* str, SizeType count) : String() {
+    if (count > INLINE_CAPACITY) grow(count);
+    if (count > 0) std::memcpy(data(), str, count);
+    set_len(count);
 }
 
-auto String::view() const -> std::string_view {
-    return std::string_view(data_);
-}
+String::String(const char* str) : String(str ? str : "", str ? std::strlen(str) : 0) {}
 
-auto String::c_str() const -> const char* {
-    return data_.c_str();
-}
+String::String(const std::string& str) : String(str.data(), str.size()) {}
 
-// ==================== 访问器 ====================
+String::String(std::string&& str) noexcept : String(str.data(), str.size()) {}
 
-auto String::operator[](SizeType index) -> char& {
-    return data_[index];
-}
+String::String(std::string_view sv) : String(sv.data(), sv.size()) {}
 
-auto String::operator[](SizeType index) const -> const char& {
-    return data_[index];
+String::String(SizeType count, char ch) : String() {
+    resize(count, ch);
 }
 
-auto String::at(SizeType index) -> Result<char, String> {
-    if (index >= data_.size()) {
-        return err<char>("index out of range");
+String::String(const String& other) : String() {
+    if (other.is_inline()) {
+        // 内联内容连同标记字节一起整体复制
+        std::memcpy(inline_, other.inline_, sizeof(inline_));
+    } else {
+        assign(other.heap_.ptr, (SizeType)other.heap_.size);
     }
-    return ok(data_[index]);
 }
 
-auto String::at(SizeType index) const -> Result<char, String> {
-    if (index >= data_.size()) {
-        return err<char>("index out of range");
-    }
-    return ok(data_[index]);
+String::String(String&& other) noexcept {
+    std::memcpy(inline_, other.inline_, sizeof(inline_));
+    other.inline_[0] = '\0';
+    other.inline_[INLINE_CAPACITY] = (char)INLINE_CAPACITY;
 }
 
-// ==================== 迭代器 ====================
-
-auto String::begin() -> Iterator {
-    return data_.begin();
+String::~String() {
+    release();
 }
 
-auto String::begin() const -> ConstIterator {
-    return data_.begin();
+auto String::operator=(const String& other) -> String& {
+    if (this != &other) assign(other.data(), other.len());
+    return *this;
 }
 
-auto String::end() -> Iterator {
-    return data_.end();
+auto String::operator=(String&& other) noexcept -> String& {
+    if (this != &other) {
+        release();
+        std::memcpy(inline_, other.inline_, sizeof(inline_));
+        other.inline_[0] = '\0';
+        other.inline_[INLINE_CAPACITY] = (char)INLINE_CAPACITY;
+    }
+    return *this;
 }
 
-auto String::end() const -> ConstIterator {
-    return data_.end();
+auto String::operator=(const char* str) -> String& {
+    return assign(str ? str : "", str ? std::strlen(str) : 0);
 }
 
-auto String::cbegin() const -> ConstIterator {
-    return data_.cbegin();
+auto String::operator=(const std::string& str) -> String& {
+    return assign(str.data(), str.size());
 }
 
-auto String::cend() const -> ConstIterator {
-    return data_.cend();
+auto String::assign(const char* str, SizeType count) -> String& {
+    if (count <= capacity()) {
+        // str 可能位于自身缓冲区内，用 memmove
+        std::memmove(data(), str, count);
+        set_len(count);
+    } else {
+        String copy(str, count);
+        *this = std::move(copy);
+    }
+    return *this;
 }
 
-// ==================== 容量 ====================
+// ==================== 转换函数 ====================
 
-auto String::len() const -> SizeType {
-    return data_.size();
+auto String::to_std_string() const -> std::string {
+    return std::string(data(), len());
 }
 
-auto String::empty() const -> bool {
-    return data_.empty();
+// ==================== 访问器 ====================
+
+auto String::at(SizeType index) -> Result<char, String> {
+    if (index >= len()) {
+        return err<char>("index out of range");
+    }
+    return ok(data()[index]);
 }
 
-auto String::capacity() const -> SizeType {
-    return data_.capacity();
+auto String::at(SizeType index) const -> Result<char, String> {
+    if (index >= len()) {
+        return err<char>("index out of range");
+    }
+    return ok(data()[index]);
 }
 
+// ==================== 容量 ====================
+
 auto String::reserve(SizeType new_cap) -> void {
-    data_.reserve(new_cap);
+    grow(new_cap);
 }
 
 auto String::shrink_to_fit() -> void {
-    data_.shrink_to_fit();
+    if (is_inline()) return;
+    SizeType count = len();
+    if (count <= INLINE_CAPACITY) {
+        char* ptr = heap_.ptr;
+        std::memcpy(inline_, ptr, count);
+        inline_[INLINE_CAPACITY] = 0;  // 先清掉堆标志，set_len 才会按内联模式写入
+        set_len(count);
+        std::free(ptr);
+    } else if (count < capacity()) {
+        heap_.ptr = checked_realloc(heap_.ptr, count + 1);
+        heap_.capacity = (std::uint64_t)count | HEAP_FLAG;
+    }
 }
 
 // ==================== 修改器 ====================
 
 auto String::clear() -> void {
-    data_.clear();
+    set_len(0);
 }
 
 auto String::insert(SizeType pos, const String& str) -> String& {
-    data_.insert(pos, str.data_);
+    if (&str == this) return insert(pos, String(str));
+    SizeType count = len();
+    if (pos > count) pos = count;
+    SizeType n = str.len();
+    grow(count + n);
+    char* d = data();
+    std::memmove(d + pos + n, d + pos, count - pos);
+    std::memcpy(d + pos, str.data(), n);
+    set_len(count + n);
     return *this;
 }
 
 auto String::erase(SizeType pos, SizeType count) -> String& {
-    data_.erase(pos, count);
+    SizeType size = len();
+    if (pos >= size) return *this;
+    if (count > size - pos) count = size - pos;
+    char* d = data();
+    std::memmove(d + pos, d + pos + count, size - pos - count);
+    set_len(size - count);
     return *this;
 }
 
 auto String::push_back(char ch) -> void {
-    data_.push_back(ch);
+    SizeType count = len();
+    if (count == capacity()) grow(count + 1);
+    data()[count] = ch;
+    set_len(count + 1);
 }
 
 auto String::pop_back() -> void {
-    data_.pop_back();
+    SizeType count = len();
+    if (count > 0) set_len(count - 1);
 }
 
-auto String::append(const String& str) -> String& {
-    data_.append(str.data_);
+auto String::resize(SizeType count, char ch) -> void {
+    SizeType size = len();
+    if (count > size) {
+        grow(count);
+        std::memset(data() + size, ch, count - size);
+    }
+    set_len(count);
+}
+
+auto String::append(const char* str, SizeType count) -> String& {
+    SizeType size = len();
+    if (size + count > capacity()) {
+        // 追加自身的一部分时，扩容会使 str 失效，先记下偏移
+        const char* old = data();
+        if (str >= old && str < old + size) {
+            SizeType offset = (SizeType)(str - old);
+            grow(size + count);
+            str = data() + offset;
+        } else {
+            grow(size + count);
+        }
+    }
+    if (count > 0) std::memcpy(data() + size, str, count);
+    set_len(size + count);
     return *this;
 }
 
-auto String::append(const char* str) -> String& {
-    data_.append(str);
+auto String::append(SizeType count, char ch) -> String& {
+    resize(len() + count, ch);
     return *this;
 }
 
+auto String::append(const String& str) -> String& {
+    return append(str.data(), str.len());
+}
+
+auto String::append(const char* str) -> String& {
+    return append(str, std::strlen(str));
+}
+
 auto String::operator+=(const String& other) -> String& {
-    data_ += other.data_;
-    return *this;
+    return append(other.data(), other.len());
 }
 
 auto String::operator+=(const char* str) -> String& {
-    data_ += str;
-    return *this;
+    return append(str, std::strlen(str));
 }
 
 auto String::operator+=(char ch) -> String& {
-    data_ += ch;
+    push_back(ch);
     return *this;
 }
 
@@ -189,102 +293,94 @@ auto operator+(const char* lhs, const String& rhs) -> String {
 // ==================== 比较 ====================
 
 auto String::operator==(const String& other) const -> bool {
-    return data_ == other.data_;
+    return view() == other.view();
 }
 
 auto String::operator!=(const String& other) const -> bool {
-    return data_ != other.data_;
+    return view() != other.view();
 }
 
 auto String::operator<(const String& other) const -> bool {
-    return data_ < other.data_;
+    return view() < other.view();
 }
 
 auto String::operator<=(const String& other) const -> bool {
-    return data_ <= other.data_;
+    return view() <= other.view();
 }
 
 auto String::operator>(const String& other) const -> bool {
-    return data_ > other.data_;
+    return view() > other.view();
 }
 
 auto String::operator>=(const String& other) const -> bool {
-    return data_ >= other.data_;
+    return view() >= other.view();
 }
 
 // ==================== 查找 / 判断类 ====================
 
 auto String::find(const String& sub) const -> std::int64_t {
-    auto pos = data_.find(sub.data_);
-    return pos == std::string::npos ? -1 : static_cast<std::int64_t>(pos);
+    auto pos = detail::search_find(data(), len(), sub.data(), sub.len());
+    return pos == npos ? -1 : static_cast<std::int64_t>(pos);
 }
 
 auto String::find(const char* sub) const -> std::int64_t {
-    auto pos = data_.find(sub);
-    return pos == std::string::npos ? -1 : static_cast<std::int64_t>(pos);
+    auto pos = detail::search_find(data(), len(), sub, std::strlen(sub));
+    return pos == npos ? -1 : static_cast<std::int64_t>(pos);
 }
 
 auto String::rfind(const String& sub) const -> std::int64_t {
-    auto pos = data_.rfind(sub.data_);
-    return pos == std::string::npos ? -1 : static_cast<std::int64_t>(pos);
+    auto pos = detail::search_rfind(data(), len(), sub.data(), sub.len());
+    return pos == npos ? -1 : static_cast<std::int64_t>(pos);
 }
 
 auto String::rfind(const char* sub) const -> std::int64_t {
-    auto pos = data_.rfind(sub);
-    return pos == std::string::npos ? -1 : static_cast<std::int64_t>(pos);
+    auto pos = detail::search_rfind(data(), len(), sub, std::strlen(sub));
+    return pos == npos ? -1 : static_cast<std::int64_t>(pos);
 }
 
 auto String::index(const String& sub) const -> Result<SizeType, String> {
-    auto pos = data_.find(sub.data_);
-    if (pos == std::string::npos) {
+    auto pos = detail::search_find(data(), len(), sub.data(), sub.len());
+    if (pos == npos) {
         return err<SizeType>("substring not found");
     }
     return ok(pos);
 }
 
 auto String::index(const char* sub) const -> Result<SizeType, String> {
-    auto pos = data_.find(sub);
-    if (pos == std::string::npos) {
+    auto pos = detail::search_find(data(), len(), sub, std::strlen(sub));
+    if (pos == npos) {
         return err<SizeType>("substring not found");
     }
     return ok(pos);
 }
 
 auto String::rindex(const String& sub) const -> Result<SizeType, String> {
-    auto pos = data_.rfind(sub.data_);
-    if (pos == std::string::npos) {
+    auto pos = detail::search_rfind(data(), len(), sub.data(), sub.len());
+    if (pos == npos) {
         return err<SizeType>("substring not found");
     }
     return ok(pos);
 }
 
 auto String::rindex(const char* sub) const -> Result<SizeType, String> {
-    auto pos = data_.rfind(sub);
-    if (pos == std::string::npos) {
+    auto pos = detail::search_rfind(data(), len(), sub, std::strlen(sub));
+    if (pos == npos) {
         return err<SizeType>("substring not found");
     }
     return ok(pos);
 }
 
 auto String::count(const String& sub) const -> SizeType {
-    SizeType count = 0;
-    SizeType pos = 0;
-    SizeType step = sub.len();
-    if (step == 0) return 0;
-    while ((pos = data_.find(sub.data_, pos)) != std::string::npos) {
-        ++count;
-        pos += step;
-    }
-    return count;
+    return detail::search_count(*this, sub);
 }
 
 auto String::count(const char* sub) const -> SizeType {
-    return count(String(sub));
+    return detail::search_count(*this, sub);
 }
 
 auto String::startswith(const String& prefix) const -> bool {
     if (prefix.len() > len()) return false;
-    return data_.compare(0, prefix.len(), prefix.data_) == 0;
+    return view().substr(0, prefix.len()) == prefix.view();
 }
 
 auto String::startswith(const char* prefix) const -> bool {
@@ -293,7 +389,7 @@ auto String::startswith(const char* prefix) const -> bool {
 
 auto String::endswith(const String& suffix) const -> bool {
     if (suffix.len() > len()) return false;
-    return data_.compare(len() - suffix.len(), suffix.len(), suffix.data_) == 0;
+    return view().substr(len() - suffix.len()) == suffix.view();
 }
 
 auto String::endswith(const char* suffix) const -> bool {
@@ -304,185 +400,130 @@ auto String::endswith(const char* suffix) const -> bool {
 
 auto String::isalpha() const -> bool {
     if (empty()) return false;
-    for (unsigned char c : data_) {
-        if (!std::isalpha(c)) return false;
-    }
-    return true;
+    return detail::unicode_all_of_class(data(), len(), detail::CharClass::Alpha);
 }
 
 auto String::isdigit() const -> bool {
     if (empty()) return false;
-    for (unsigned char c : data_) {
-        if (!std::isdigit(c)) return false;
-    }
-    return true;
+    return detail::unicode_all_of_class(data(), len(), detail::CharClass::Digit);
 }
 
 auto String::isalnum() const -> bool {
     if (empty()) return false;
-    for (unsigned char c : data_) {
-        if (!std::isalnum(c)) return false;
-    }
-    return true;
+    return detail::unicode_all_of_class(data(), len(), detail::CharClass::Alnum);
 }
 
 auto String::islower() const -> bool {
-    bool has_lower = false;
-    for (unsigned char c : data_) {
-        if (std::isalpha(c)) {
-            if (!std::islower(c)) return false;
-            has_lower = true;
-        }
-    }
-    return has_lower;
+    return detail::unicode_scan_case(data(), len()) == detail::CASE_HAS_LOWER;
 }
 
 auto String::isupper() const -> bool {
-    bool has_upper = false;
-    for (unsigned char c : data_) {
-        if (std::isalpha(c)) {
-            if (!std::isupper(c)) return false;
-            has_upper = true;
-        }
-    }
-    return has_upper;
+    return detail::unicode_scan_case(data(), len()) == detail::CASE_HAS_UPPER;
 }
 
 auto String::isspace() const -> bool {
     if (empty()) return false;
-    for (unsigned char c : data_) {
-        if (!std::isspace(c)) return false;
-    }
-    return true;
+    return detail::unicode_all_of_class(data(), len(), detail::CharClass::Space);
 }
 
 auto String::istitle() const -> bool {
-    bool in_word = false;
-    for (unsigned char c : data_) {
-        if (std::isalpha(c)) {
-            if (in_word) {
-                if (!std::islower(c)) return false;
-            } else {
-                if (!std::isupper(c)) return false;
-                in_word = true;
-            }
-        } else {
-            in_word = false;
-        }
-    }
-    return true;
+    return detail::unicode_istitle(data(), len());
 }
 
 // ==================== 大小写转换 ====================
 
 auto String::lower() const -> String {
-    std::string result;
-    result.reserve(len());
-    for (unsigned char c : data_) {
-        result.push_back(static_cast<char>(std::tolower(c)));
-    }
-    return String(std::move(result));
+    return detail::unicode_convert_case(data(), len(), detail::CaseOp::Lower);
 }
 
 auto String::upper() const -> String {
-    std::string result;
-    result.reserve(len());
-    for (unsigned char c : data_) {
-        result.push_back(static_cast<char>(std::toupper(c)));
-    }
-    return String(std::move(result));
+    return detail::unicode_convert_case(data(), len(), detail::CaseOp::Upper);
 }
 
 auto String::capitalize() const -> String {
-    if (empty()) return *this;
-    std::string result = data_;
-    // 首字符大写（如果是字母）
-    result[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(result[0])));
-    for (std::size_t i = 1; i < result.size(); ++i) {
-        result[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(result[i])));
-    }
-    return String(std::move(result));
+    return detail::unicode_capitalize(data(), len());
 }
 
 auto String::title() const -> String {
-    std::string result;
-    result.reserve(len());
-    bool new_word = true;
-    for (unsigned char c : data_) {
-        if (std::isalpha(c)) {
-            if (new_word) {
-                result.push_back(static_cast<char>(std::toupper(c)));
-                new_word = false;
-            } else {
-                result.push_back(static_cast<char>(std::tolower(c)));
-            }
-        } else {
-            result.push_back(static_cast<char>(c));
-            new_word = true;
-        }
-    }
-    return String(std::move(result));
+    return detail::unicode_title(data(), len());
 }
 
 auto String::swapcase() const -> String {
-    std::string result;
-    result.reserve(len());
-    for (unsigned char c : data_) {
-        if (std::isupper(c)) {
-            result.push_back(static_cast<char>(std::tolower(c)));
-        } else if (std::islower(c)) {
-            result.push_back(static_cast<char>(std::toupper(c)));
-        } else {
-            result.push_back(static_cast<char>(c));
-        }
-    }
-    return String(std::move(result));
+    return detail::unicode_convert_case(data(), len(), detail::CaseOp::Swap);
 }
 
 // ==================== 辅助函数 ====================
 
 auto String::is_whitespace(char c) -> bool {
-    return std::isspace(static_cast<unsigned char>(c)) != 0;
+    return detail::WHITESPACE_SET.contains(c);
 }
 
-auto String::trim_left(const String& chars) const -> String {
-    SizeType start = 0;
-    while (start < len() && chars.find(data_[start]) != -1) {
-        ++start;
-    }
-    return substr(start);
+auto String::trim_range(const detail::ByteSet& set, bool left, bool right) const
+    -> std::pair<SizeType, SizeType> {
+    SizeType start = left ? set.span_left(data(), len()) : 0;
+    SizeType end = right ? set.span_right(data(), start, len()) : len();
+    return {start, end};
 }
 
-auto String::trim_right(const String& chars) const -> String {
-    SizeType end = len();
-    while (end > 0 && chars.find(data_[end-1]) != -1) {
-        --end;
-    }
-    return substr(0, end);
+auto String::trim(const detail::ByteSet& set, bool left, bool right) const -> String {
+    auto [start, end] = trim_range(set, left, right);
+    return String(view().substr(start, end - start));
+}
+
+auto String::trim_inplace(const detail::ByteSet& set, bool left, bool right) -> String& {
+    auto [start, end] = trim_range(set, left, right);
+    // 先截掉尾部，再整体前移，只移动保留下来的字节
+    erase(end, npos);
+    erase(0, start);
+    return *this;
 }
 
 auto String::strip() const -> String {
-    return strip(String(" \t\n\r\f\v"));
+    return trim(detail::WHITESPACE_SET, true, true);
 }
 
 auto String::strip(const String& chars) const -> String {
-    return trim_left(chars).trim_right(chars);
+    return trim(detail::ByteSet(chars.view()), true, true);
 }
 
 auto String::lstrip() const -> String {
-    return lstrip(String(" \t\n\r\f\v"));
+    return trim(detail::WHITESPACE_SET, true, false);
 }
 
 auto String::lstrip(const String& chars) const -> String {
-    return trim_left(chars);
+    return trim(detail::ByteSet(chars.view()), true, false);
 }
 
 auto String::rstrip() const -> String {
-    return rstrip(String(" \t\n\r\f\v"));
+    return trim(detail::WHITESPACE_SET, false, true);
 }
 
 auto String::rstrip(const String& chars) const -> String {
-    return trim_right(chars);
+    return trim(detail::ByteSet(chars.view()), false, true);
+}
+
+auto String::strip_inplace() -> String& {
+    return trim_inplace(detail::WHITESPACE_SET, true, true);
+}
+
+auto String::strip_inplace(const String& chars) -> String& {
+    return trim_inplace(detail::ByteSet(chars.view()), true, true);
+}
+
+auto String::lstrip_inplace() -> String& {
+    return trim_inplace(detail::WHITESPACE_SET, true, false);
+}
+
+auto String::lstrip_inplace(const String& chars) -> String& {
+    return trim_inplace(detail::ByteSet(chars.view()), true, false);
+}
+
+auto String::rstrip_inplace() -> String& {
+    return trim_inplace(detail::WHITESPACE_SET, false, true);
+}
+
+auto String::rstrip_inplace(const String& chars) -> String& {
+    return trim_inplace(detail::ByteSet(chars.view()), false, true);
 }
 
 auto String::center(SizeType width) const -> String {
@@ -494,7 +535,9 @@ auto String::center(SizeType width, char fillchar) const -> String {
     SizeType total_pad = width - len();
     SizeType left_pad = total_pad / 2;
     SizeType right_pad = total_pad - left_pad;
-    return String(left_pad, fillchar) + *this + String(right_pad, fillchar);
+    StringBuilder out(width);
+    out.append(left_pad, fillchar).append(*this).append(right_pad, fillchar);
+    return out.finish();
 }
 
 auto String::ljust(SizeType width) const -> String {
@@ -503,7 +546,9 @@ auto String::ljust(SizeType width) const -> String {
 
 auto String::ljust(SizeType width, char fillchar) const -> String {
     if (width <= len()) return *this;
-    return *this + String(width - len(), fillchar);
+    StringBuilder out(width);
+    out.append(*this).append(width - len(), fillchar);
+    return out.finish();
 }
 
 auto String::rjust(SizeType width) const -> String {
@@ -512,86 +557,60 @@ auto String::rjust(SizeType width) const -> String {
 
 auto String::rjust(SizeType width, char fillchar) const -> String {
     if (width <= len()) return *this;
-    return String(width - len(), fillchar) + *this;
+    StringBuilder out(width);
+    out.append(width - len(), fillchar).append(*this);
+    return out.finish();
 }
 
 auto String::zfill(SizeType width) const -> String {
     if (width <= len()) return *this;
-    bool negative = !empty() && data_[0] == '-';
     SizeType pad = width - len();
-    if (negative) {
-        return String("-") + String(pad, '0') + substr(1);
+    StringBuilder out(width);
+    if (!empty() && data()[0] == '-') {
+        // 符号保留在最前面，0 填充在符号之后
+        out.append('-').append(pad, '0').append(StringView(data() + 1, len() - 1));
     } else {
-        return String(pad, '0') + *this;
+        out.append(pad, '0').append(*this);
     }
+    return out.finish();
 }
 
 // ==================== 分割 / 连接 ====================
 
-auto String::split() const -> std::vector<String> {
+auto String::split(std::int64_t maxsplit) const -> std::vector<String> {
     std::vector<String> result;
-    SizeType start = 0;
-    SizeType end = 0;
-    while (end < len()) {
-        // 跳过空白
-        while (end < len() && is_whitespace(data_[end])) ++end;
-        if (end >= len()) break;
-        start = end;
-        // 找到非空白结束
-        while (end < len() && !is_whitespace(data_[end])) ++end;
-        result.push_back(substr(start, end - start));
+    for (auto field : split_iter(maxsplit)) {
+        result.push_back(field.to_string());
     }
     return result;
 }
 
-auto String::split(const String& sep) const -> std::vector<String> {
+auto String::split(const String& sep, std::int64_t maxsplit) const -> std::vector<String> {
+    // 空分隔符按字符拆分（Python 会抛出 ValueError）
     std::vector<String> result;
-    if (sep.empty()) {
-        // 按字符分割？按照 Python 行为，空分隔符会引发 ValueError，但我们返回每个字符
-        for (char c : data_) {
-            result.push_back(String(1, c));
-        }
-        return result;
+    for (auto field : split_iter(sep, maxsplit)) {
+        result.push_back(field.to_string());
     }
-    SizeType pos = 0;
-    SizeType found;
-    while ((found = data_.find(sep.data_, pos)) != std::string::npos) {
-        result.push_back(substr(pos, found - pos));
-        pos = found + sep.len();
-    }
-    result.push_back(substr(pos));
     return result;
 }
 
-auto String::split(const char* sep) const -> std::vector<String> {
-    return split(String(sep));
-}
-
-auto String::rsplit() const -> std::vector<String> {
-    // 与 split 相同，默认按空白分割
-    return split();
-}
-
-auto String::rsplit(const String& sep) const -> std::vector<String> {
+auto String::rsplit(std::int64_t maxsplit) const -> std::vector<String> {
+    // rsplit_iter 从右往左产生字段：依次追加后整体反转，避免每次在头部插入
     std::vector<String> result;
-    if (sep.empty()) {
-        for (char c : data_) {
-            result.push_back(String(1, c));
-        }
-        return result;
-    }
-    SizeType pos = len();
-    SizeType found;
-    while ((found = data_.rfind(sep.data_, pos - 1)) != std::string::npos) {
-        result.insert(result.begin(), substr(found + sep.len(), pos - found - sep.len()));
-        pos = found;
+    for (auto field : rsplit_iter(maxsplit)) {
+        result.push_back(field.to_string());
     }
-    result.insert(result.begin(), substr(0, pos));
+    std::reverse(result.begin(), result.end());
     return result;
 }
 
-auto String::rsplit(const char* sep) const -> std::vector<String> {
-    return rsplit(String(sep));
+auto String::rsplit(const String& sep, std::int64_t maxsplit) const -> std::vector<String> {
+    std::vector<String> result;
+    for (auto field : rsplit_iter(sep, maxsplit)) {
+        result.push_back(field.to_string());
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
 }
 
 auto String::splitlines(bool keepends) const -> std::vector<String> {
@@ -599,10 +618,10 @@ auto String::splitlines(bool keepends) const -> std::vector<String> {
     SizeType start = 0;
     SizeType end = 0;
     while (end < len()) {
-        if (data_[end] == '\n' || data_[end] == '\r') {
+        if (data()[end] == '\n' || data()[end] == '\r') {
             SizeType line_end = end;
             // 处理 \r\n
-            if (data_[end] == '\r' && end + 1 < len() && data_[end + 1] == '\n') {
+            if (data()[end] == '\r' && end + 1 < len() && data()[end + 1] == '\n') {
                 if (keepends) {
                     result.push_back(substr(start, end + 2 - start));
                 } else {
@@ -630,8 +649,8 @@ auto String::splitlines(bool keepends) const -> std::vector<String> {
 
 auto String::partition(const String& sep) const -> std::vector<String> {
     std::vector<String> result;
-    auto pos = data_.find(sep.data_);
-    if (pos == std::string::npos) {
+    auto pos = detail::search_find(data(), len(), sep.data(), sep.len());
+    if (pos == npos) {
         result.push_back(*this);
         result.push_back(String());
         result.push_back(String());
@@ -649,8 +668,8 @@ auto String::partition(const char* sep) const -> std::vector<String> {
 
 auto String::rpartition(const String& sep) const -> std::vector<String> {
     std::vector<String> result;
-    auto pos = data_.rfind(sep.data_);
-    if (pos == std::string::npos) {
+    auto pos = detail::search_rfind(data(), len(), sep.data(), sep.len());
+    if (pos == npos) {
         result.push_back(String());
         result.push_back(String());
         result.push_back(*this);
@@ -696,28 +715,17 @@ auto String::join(const std::vector<const char*>& strings, const String& sep) ->
 // ==================== 替换 ====================
 
 auto String::replace(const String& old, const String& new_str) const -> String {
-    if (old.empty()) return *this;
-    std::string result;
-    SizeType pos = 0;
-    SizeType found;
-    SizeType old_len = old.len();
-    while ((found = data_.find(old.data_, pos)) != std::string::npos) {
-        result.append(data_, pos, found - pos);
-        result.append(new_str.data_);
-        pos = found + old_len;
-    }
-    result.append(data_, pos);
-    return String(std::move(result));
+    return detail::search_replace(*this, old, new_str);
 }
 
 auto String::replace(const char* old, const char* new_str) const -> String {
-    return replace(String(old), String(new_str));
+    return detail::search_replace(*this, old, new_str);
 }
 
 auto String::expandtabs(SizeType tabsize) const -> String {
-    std::string result;
+    String result;
     SizeType column = 0;
-    for (char c : data_) {
+    for (char c : *this) {
         if (c == '\t') {
             SizeType spaces = tabsize - (column % tabsize);
             result.append(spaces, ' ');
@@ -731,7 +739,7 @@ auto String::expandtabs(SizeType tabsize) const -> String {
             }
         }
     }
-    return String(std::move(result));
+    return result;
 }
 
 // ==================== 编码 / 解码 ====================
@@ -739,7 +747,7 @@ auto String::expandtabs(SizeType tabsize) const -> String {
 auto String::encode(const char* encoding) const -> std::vector<std::uint8_t> {
     // 简化：只处理 UTF-8，直接返回字节
     if (std::strcmp(encoding, "utf-8") == 0 || std::strcmp(encoding, "UTF-8") == 0) {
-        std::vector<std::uint8_t> bytes(data_.begin(), data_.end());
+        std::vector<std::uint8_t> bytes(begin(), end());
         return bytes;
     }
     // 其他编码暂不支持
@@ -748,33 +756,14 @@ auto String::encode(const char* encoding) const -> std::vector<std::uint8_t> {
 
 auto String::decode(const std::vector<std::uint8_t>& bytes, const char* encoding) -> Result<String, String> {
     if (std::strcmp(encoding, "utf-8") == 0 || std::strcmp(encoding, "UTF-8") == 0) {
-        // 简单的 UTF-8 有效性检查（略）
-        std::string str(bytes.begin(), bytes.end());
-        return ok(String(std::move(str)));
-    }
-    return err<String>("unsupported encoding");
-}
-
-// ==================== 格式化 ====================
-
-auto String::format(const std::vector<String>& args) const -> Result<String, String> {
-    std::string result;
-    SizeType last = 0;
-    SizeType arg_index = 0;
-    for (SizeType i = 0; i < len(); ++i) {
-        if (data_[i] == '{' && i + 1 < len() && data_[i+1] == '}') {
-            result.append(data_, last, i - last);
-            if (arg_index >= args.size()) {
-                return err<String>("not enough arguments for format");
-            }
-            result.append(args[arg_index].data_);
-            ++arg_index;
-            i += 1; // 跳过 '}'
-            last = i + 1;
+        const char* data = (const char*)bytes.data();
+        if (!detail::utf8_validate(data, bytes.size())) {
+            return err<String>(String("invalid utf-8 at byte ")
+                               + String::from_uint(detail::utf8_error_offset(data, bytes.size())));
         }
+        return ok(String(data, bytes.size()));
     }
-    result.append(data_, last, len() - last);
-    return ok(String(std::move(result)));
+    return err<String>("unsupported encoding");
 }
 
 // ==================== 其他实用 ====================
@@ -784,21 +773,22 @@ auto String::substr(SizeType pos, SizeType count) const -> String {
     if (count == npos || pos + count > len()) {
         count = len() - pos;
     }
-    return String(data_.substr(pos, count));
+    return String(data() + pos, count);
 }
 
 auto String::reverse() const -> String {
-    std::string result(data_.rbegin(), data_.rend());
-    return String(std::move(result));
+    String result(len(), '\0');
+    std::reverse_copy(begin(), end(), result.begin());
+    return result;
 }
 
 auto String::repeat(SizeType times) const -> String {
-    std::string result;
+    String result;
     result.reserve(len() * times);
     for (SizeType i = 0; i < times; ++i) {
-        result += data_;
+        result.append(data(), len());
     }
-    return String(std::move(result));
+    return result;
 }
 
 auto operator*(const String& str, String::SizeType times) -> String {
@@ -809,32 +799,6 @@ auto operator*(String::SizeType times, const String& str) -> String {
     return str.repeat(times);
 }
 
-auto String::to_int() const -> Result<std::int64_t, String> {
-    char* endptr;
-    errno = 0;
-    long long val = std::strtoll(data_.c_str(), &endptr, 10);
-    if (errno == ERANGE || val > INT64_MAX || val < INT64_MIN) {
-        return err<std::int64_t>("integer out of range");
-    }
-    if (endptr == data_.c_str() || *endptr != '\0') {
-        return err<std::int64_t>("invalid integer format");
-    }
-    return ok(static_cast<std::int64_t>(val));
-}
-
-auto String::to_float() const -> Result<double, String> {
-    char* endptr;
-    errno = 0;
-    double val = std::strtod(data_.c_str(), &endptr);
-    if (errno == ERANGE) {
-        return err<double>("float out of range");
-    }
-    if (endptr == data_.c_str() || *endptr != '\0') {
-        return err<double>("invalid float format");
-    }
-    return ok(val);
-}
-
 // ==================== 静态辅助函数 ====================
 
 auto String::is_ascii_alpha(char c) -> bool {
@@ -4,29 +4,53 @@
 #include <vector>
 #include <cstdint>
 #include <algorithm>
-#include <cctype>
 #include <string_view>
 #include <initializer_list>
+#include <utility>
 #include <sstream>
 
 #include "result.hpp"
+#include "ascii.hpp"
+#include "format.hpp"
 
 namespace ks {
 
+class StringView;
+class SplitRange;
+class CharRange;
+
+template<typename T>
+class Dict;
+
+/// 字符串：24 字节对象，不超过 23 字节的内容直接存放在对象内部（小字符串优化）。
+/// 布局不依赖标准库实现：
+///   内联模式：bytes[0, 23) 为内容，bytes[23] = 23 - 长度，长度为 23 时它恰好兼作 '\0'；
+///   堆模式：  { char* ptr; uint64 size; uint64 capacity | HEAP_FLAG }，
+///             标志位是 capacity 的最高位，在小端序下即 bytes[23] 的最高位。
+/// 内容始终以 '\0' 结尾，c_str() 不需要额外分配
 class String {
 public:
     // 类型定义
     using SizeType = std::size_t;
-    using Iterator = std::string::iterator;
-    using ConstIterator = std::string::const_iterator;
+    using Iterator = char*;
+    using ConstIterator = const char*;
+    using value_type = char;  // 供 std::back_inserter 使用
+
+    /// 内联缓冲区能容纳的最大长度
+    static constexpr SizeType INLINE_CAPACITY = 23;
 
     // 构造函数
-    String() = default;
+    String() {
+        inline_[0] = '\0';
+        inline_[INLINE_CAPACITY] = (char)INLINE_CAPACITY;
+    }
     String(const char* str);
+    String(const char* str, SizeType count);
     String(const std::string& str);
     String(std::string&& str) noexcept;
-    String(const String& other) = default;
-    String(String&& other) noexcept = default;
+    String(const String& other);
+    String(String&& other) noexcept;
+    ~String();
     
     // 从字符串视图构造
     explicit String(std::string_view sv);
@@ -35,38 +59,51 @@ public:
     String(SizeType count, char ch);
     
     // 赋值操作
-    auto operator=(const String& other) -> String& = default;
-    auto operator=(String&& other) noexcept -> String& = default;
+    auto operator=(const String& other) -> String&;
+    auto operator=(String&& other) noexcept -> String&;
     auto operator=(const char* str) -> String&;
     auto operator=(const std::string& str) -> String&;
     
+    /// 用 str[0, count) 替换全部内容，str 可以指向自身
+    auto assign(const char* str, SizeType count) -> String&;
+    
     // 转换为 std::string
     auto to_std_string() const -> std::string;
     
     // 转换为字符串视图
-    auto view() const -> std::string_view;
+    auto view() const -> std::string_view { return std::string_view(data(), len()); }
     
     // 转换为 C 字符串
-    auto c_str() const -> const char*;
+    auto c_str() const -> const char* { return data(); }
+    
+    /// 内容首地址，data()[len()] 恒为 '\0'
+    auto data() const -> const char* { return is_inline() ? inline_ : heap_.ptr; }
+    auto data() -> char* { return is_inline() ? inline_ : heap_.ptr; }
     
     // 访问器
-    auto operator[](SizeType index) -> char&;
-    auto operator[](SizeType index) const -> const char&;
+    auto operator[](SizeType index) -> char& { return data()[index]; }
+    auto operator[](SizeType index) const -> const char& { return data()[index]; }
     auto at(SizeType index) -> Result<char, String>;
     auto at(SizeType index) const -> Result<char, String>;
     
     // 迭代器
-    auto begin() -> Iterator;
-    auto begin() const -> ConstIterator;
-    auto end() -> Iterator;
-    auto end() const -> ConstIterator;
-    auto cbegin() const -> ConstIterator;
-    auto cend() const -> ConstIterator;
+    auto begin() -> Iterator { return data(); }
+    auto begin() const -> ConstIterator { return data(); }
+    auto end() -> Iterator { return data() + len(); }
+    auto end() const -> ConstIterator { return data() + len(); }
+    auto cbegin() const -> ConstIterator { return begin(); }
+    auto cend() const -> ConstIterator { return end(); }
     
     // 容量
-    auto len() const -> SizeType;
-    auto empty() const -> bool;
-    auto capacity() const -> SizeType;
+    auto len() const -> SizeType {
+        return is_inline() ? INLINE_CAPACITY - (SizeType)tag() : (SizeType)heap_.size;
+    }
+    auto empty() const -> bool { return len() == 0; }
+    auto capacity() const -> SizeType {
+        return is_inline() ? INLINE_CAPACITY : (SizeType)(heap_.capacity & ~HEAP_FLAG);
+    }
+    /// 内容是否存放在对象内部
+    auto is_inline() const -> bool { return tag() < 0x80; }
     auto reserve(SizeType new_cap) -> void;
     auto shrink_to_fit() -> void;
     
@@ -76,8 +113,13 @@ public:
     auto erase(SizeType pos, SizeType count = 1) -> String&;
     auto push_back(char ch) -> void;
     auto pop_back() -> void;
+    /// 改变长度，新增部分以 ch 填充
+    auto resize(SizeType count, char ch = '\0') -> void;
     auto append(const String& str) -> String&;
     auto append(const char* str) -> String&;
+    /// 追加 str[0, count)，str 可以指向自身
+    auto append(const char* str, SizeType count) -> String&;
+    auto append(SizeType count, char ch) -> String&;
     auto operator+=(const String& other) -> String&;
     auto operator+=(const char* str) -> String&;
     auto operator+=(char ch) -> String&;
@@ -177,6 +219,14 @@ public:
     auto rstrip() const -> String;
     auto rstrip(const String& chars) const -> String;
     
+    /// 原地修剪，不创建新字符串，返回自身
+    auto strip_inplace() -> String&;
+    auto strip_inplace(const String& chars) -> String&;
+    auto lstrip_inplace() -> String&;
+    auto lstrip_inplace(const String& chars) -> String&;
+    auto rstrip_inplace() -> String&;
+    auto rstrip_inplace(const String& chars) -> String&;
+    
     /// 居中
     auto center(SizeType width) const -> String;
     auto center(SizeType width, char fillchar) const -> String;
@@ -194,19 +244,36 @@ public:
     
     // ---------- 分割 / 连接 ----------
     
-    /// 按分隔符拆成列表
-    auto split() const -> std::vector<String>;  // 默认按空白分割
-    auto split(const String& sep) const -> std::vector<String>;
-    auto split(const char* sep) const -> std::vector<String>;
+    /// 按分隔符拆成列表，maxsplit 为最多拆分次数，负数表示不限制，语义与 Python 相同
+    auto split(std::int64_t maxsplit = -1) const -> std::vector<String>;  // 默认按空白分割
+    auto split(const String& sep, std::int64_t maxsplit = -1) const -> std::vector<String>;
     
-    /// 从右拆
-    auto rsplit() const -> std::vector<String>;
-    auto rsplit(const String& sep) const -> std::vector<String>;
-    auto rsplit(const char* sep) const -> std::vector<String>;
+    /// 从右拆：拆分次数受限时从右边开始拆，结果仍按从左到右的顺序排列
+    auto rsplit(std::int64_t maxsplit = -1) const -> std::vector<String>;
+    auto rsplit(const String& sep, std::int64_t maxsplit = -1) const -> std::vector<String>;
     
     /// 按换行拆
     auto splitlines(bool keepends = false) const -> std::vector<String>;
     
+    /// 惰性拆分：逐个产生指向本字符串的 StringView 字段，可用于范围 for 并提前停止。
+    /// maxsplit 为最多拆分次数，负数表示不限制；迭代期间本字符串必须保持有效。
+    /// 临时 String 上调用会留下悬空的字段，因此禁止，需要时先存为具名变量。
+    /// 不超过 SplitRange::SEP_INLINE_CAPACITY 字节的 sep 会被复制，可以传临时对象；更长的 sep 也必须保持有效
+    auto split_iter(std::int64_t maxsplit = -1) const& -> SplitRange;  // 默认按空白分割
+    auto split_iter(StringView sep, std::int64_t maxsplit = -1) const& -> SplitRange;
+    auto split_iter(std::int64_t maxsplit = -1) && -> SplitRange = delete;
+    auto split_iter(StringView sep, std::int64_t maxsplit = -1) && -> SplitRange = delete;
+    
+    /// 惰性从右拆：字段按从右到左的顺序产生
+    auto rsplit_iter(std::int64_t maxsplit = -1) const& -> SplitRange;
+    auto rsplit_iter(StringView sep, std::int64_t maxsplit = -1) const& -> SplitRange;
+    auto rsplit_iter(std::int64_t maxsplit = -1) && -> SplitRange = delete;
+    auto rsplit_iter(StringView sep, std::int64_t maxsplit = -1) && -> SplitRange = delete;
+    
+    /// 惰性按换行拆
+    auto splitlines_iter(bool keepends = false) const& -> SplitRange;
+    auto splitlines_iter(bool keepends = false) && -> SplitRange = delete;
+    
     /// 分成 (前, sep, 后) 三元组
     auto partition(const String& sep) const -> std::vector<String>;
     auto partition(const char* sep) const -> std::vector<String>;
@@ -226,6 +293,10 @@ public:
     auto replace(const String& old, const String& new_str) const -> String;
     auto replace(const char* old, const char* new_str) const -> String;
     
+    /// 一遍扫描替换多个子串：键为要查找的子串，值为替换串，命中按最左最长、互不重叠的规则选取。
+    /// 每次调用都会构建自动机，对同一组替换反复使用时请直接复用 MultiSearcher
+    auto replace_all(const Dict<String>& replacements) const -> String;
+    
     /// 替换 tab 为空格
     auto expandtabs(SizeType tabsize = 8) const -> String;
     
@@ -234,20 +305,69 @@ public:
     /// 转 bytes
     auto encode(const char* encoding = "utf-8") const -> std::vector<std::uint8_t>;
     
-    /// bytes 转 str
+    /// bytes 转 str，UTF-8 输入会先校验，非法时返回第一个非法字节的位置
     static auto decode(const std::vector<std::uint8_t>& bytes, const char* encoding = "utf-8") -> Result<String, String>;
     
+    // ---------- Unicode（定义在 utf8.cpp）----------
+    
+    /// 是否为合法 UTF-8
+    auto is_utf8() const -> bool;
+    
+    /// 码点个数，len() 是字节数
+    auto char_len() const -> SizeType;
+    
+    /// 逐个码点遍历：for (char32_t c : s.chars())
+    auto chars() const -> CharRange;
+    
+    /// 转为 UTF-16 / UTF-32，内容不是合法 UTF-8 时返回错误
+    auto to_utf16() const -> Result<std::u16string, String>;
+    auto to_utf32() const -> Result<std::u32string, String>;
+    
+    /// 由 UTF-16 / UTF-32 构造，遇到孤立代理项或超出范围的码点时返回错误
+    static auto from_utf16(std::u16string_view text) -> Result<String, String>;
+    static auto from_utf32(std::u32string_view text) -> Result<String, String>;
+    
+    /// 数值的十进制文本，浮点数取能解析回同一个值的最短表示（定义在 charconv.cpp）
+    static auto from_int(std::int64_t value) -> String;
+    static auto from_uint(std::uint64_t value) -> String;
+    static auto from_float(double value) -> String;
+    static auto from_float(float value) -> String;
+    
+    /// 按类型选择上面的函数，bool 和 char 按整数处理
+    template<typename T>
+    static auto from_number(T value) -> String {
+        static_assert(std::is_arithmetic_v<T>, "from_number requires an arithmetic type");
+        if constexpr (std::is_same_v<T, float>) {
+            return from_float(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return from_float((double)value);
+        } else if constexpr (std::is_signed_v<T>) {
+            return from_int(value);
+        } else {
+            return from_uint(value);
+        }
+    }
+    
     // ---------- 格式化 ----------
     
-    /// 简单格式化（仅支持 {} 占位符）
+    /// 格式化，语法见 format.hpp，参数直接写入结果的缓冲区（定义在 string_builder.cpp）。
+    /// 格式错误、参数不足或格式说明不适用于参数时返回错误，多余的参数被忽略
     auto format(const std::vector<String>& args) const -> Result<String, String>;
 
     template<typename... Args>
     auto format(Args&&... args) const -> Result<String, String> {
-        std::vector<String> vec;
-        (vec.push_back(String(to_string(std::forward<Args>(args)))), ...);
-        return format(vec);
+        if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::decay_t<Args>, std::vector<String>> && ...)) {
+            return format(std::as_const(args)...);
+        } else {
+            detail::FormatArg list[sizeof...(Args) + 1] = {
+                detail::FormatArg{&args, &detail::write_format_arg<std::remove_cv_t<std::remove_reference_t<Args>>>}...
+            };
+            return format_args(list, sizeof...(Args));
+        }
     }
+
+    /// format 的非模板部分
+    auto format_args(const detail::FormatArg* args, SizeType count) const -> Result<String, String>;
     
     // ---------- 其他实用 ----------
     
@@ -262,36 +382,41 @@ public:
     friend auto operator*(const String& str, SizeType times) -> String;
     friend auto operator*(SizeType times, const String& str) -> String;
     
-    /// 转换为整数
+    /// 转换为整数，允许首尾空白（定义在 charconv.cpp）
     auto to_int() const -> Result<std::int64_t, String>;
     
-    /// 转换为浮点数
+    /// 转换为浮点数，允许首尾空白（定义在 charconv.cpp）
     auto to_float() const -> Result<double, String>;
     
     /// 静态常量
     static const SizeType npos = static_cast<SizeType>(-1);
     
 private:
-    std::string data_;
+    static constexpr std::uint64_t HEAP_FLAG = (std::uint64_t)1 << 63;
+
+    // 显式对齐到 8 字节，32 位平台上各字段偏移也与 64 位相同
+    struct Heap {
+        alignas(8) char* ptr;
+        alignas(8) std::uint64_t size;
+        alignas(8) std::uint64_t capacity;  // 最高位为 HEAP_FLAG
+    };
+
+    union {
+        char inline_[INLINE_CAPACITY + 1];
+        Heap heap_;
+    };
+
+    /// 最后一个字节：内联模式下为剩余容量，堆模式下最高位为 1
+    auto tag() const -> unsigned char { return ((const unsigned char*)inline_)[INLINE_CAPACITY]; }
     
-    /// 辅助函数：将任意类型转换为字符串（用于format）
-    template<typename T>
-    static auto to_string(T&& value) -> std::string {
-        if constexpr (std::is_arithmetic_v<std::decay_t<T>>) {
-            return std::to_string(std::forward<T>(value));
-        } else if constexpr (std::is_same_v<std::decay_t<T>, String>) {
-            return std::forward<T>(value).data_;
-        } else if constexpr (std::is_same_v<std::decay_t<T>, std::string>) {
-            return std::forward<T>(value);
-        } else if constexpr (std::is_same_v<std::decay_t<T>, const char*>) {
-            return std::string(std::forward<T>(value));
-        } else {
-            // 默认尝试使用流输出
-            std::ostringstream oss;
-            oss << std::forward<T>(value);
-            return oss.str();
-        }
-    }
+    /// 设置长度并写入结尾的 '\0'，不检查容量
+    auto set_len(SizeType count) -> void;
+    
+    /// 保证容量至少为 new_cap，按两倍增长，保留原有内容
+    auto grow(SizeType new_cap) -> void;
+    
+    /// 释放堆缓冲区（不重置状态）
+    auto release() -> void;
     
     /// 检查字符是否为空白
     static auto is_whitespace(char c) -> bool;
@@ -305,9 +430,21 @@ private:
     /// 检查字符是否为字母数字
     static auto is_ascii_alnum(char c) -> bool;
     
-    /// 修剪辅助函数
-    auto trim_left(const String& chars) const -> String;
-    auto trim_right(const String& chars) const -> String;
+    /// 修剪辅助函数：计算去掉集合中字符后剩余部分的 [start, end)
+    auto trim_range(const detail::ByteSet& set, bool left, bool right) const -> std::pair<SizeType, SizeType>;
+    auto trim(const detail::ByteSet& set, bool left, bool right) const -> String;
+    auto trim_inplace(const detail::ByteSet& set, bool left, bool right) -> String&;
 };
 
-} // namespace ks
\ No newline at end of file
+static_assert(sizeof(String) == 24, "ks::String must stay 24 bytes");
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#error "ks::String stores its heap flag in the last byte and requires a little-endian target"
+#endif
+
+} // namespace ks
+
+// SplitRange 定义在 string_view.hpp 中，CharRange 定义在 utf8.hpp 中，
+// 放在末尾包含以保证 split_iter、chars 的返回类型完整
+#include "string_view.hpp"
+#include "utf8.hpp"
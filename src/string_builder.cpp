@@ -0,0 +1,305 @@
+#include "string_builder.hpp"
+#include "charconv.hpp"
+#include "check.hpp"
+#include "utf8.hpp"
+#include <cmath>
+#include <cstdio>
+
+namespace ks {
+
+// ==================== 数值 ====================
+
+auto StringBuilder::append_uint(std::uint64_t value) -> StringBuilder& {
+    char digits[INT_CHARS_MAX];
+    buffer_.append(digits, (SizeType)(format_uint(value, digits) - digits));
+    return *this;
+}
+
+auto StringBuilder::append_int(std::int64_t value) -> StringBuilder& {
+    char digits[INT_CHARS_MAX];
+    buffer_.append(digits, (SizeType)(format_int(value, digits) - digits));
+    return *this;
+}
+
+auto StringBuilder::append_float(double value) -> StringBuilder& {
+    char text[FLOAT_CHARS_MAX];
+    buffer_.append(text, (SizeType)(format_float(value, text) - text));
+    return *this;
+}
+
+auto StringBuilder::append_float(float value) -> StringBuilder& {
+    char text[FLOAT_CHARS_MAX];
+    buffer_.append(text, (SizeType)(format_float(value, text) - text));
+    return *this;
+}
+
+auto StringBuilder::append_float(double value, int precision) -> StringBuilder& {
+    char stack[64];
+    if (char* end = detail::format_fixed(value, precision, stack)) {
+        buffer_.append(stack, (SizeType)(end - stack));
+        return *this;
+    }
+    int n = std::snprintf(stack, sizeof(stack), "%.*f", precision, value);
+    if (n < 0) return *this;
+    if ((SizeType)n < sizeof(stack)) {
+        buffer_.append(stack, (SizeType)n);
+    } else {
+        // 很大的数：直接格式化到缓冲区尾部
+        SizeType size = len();
+        buffer_.resize(size + (SizeType)n);
+        std::snprintf(buffer_.data() + size, (SizeType)n + 1, "%.*f", precision, value);
+    }
+    return *this;
+}
+
+// ==================== 格式说明 ====================
+
+namespace {
+
+auto append_fill(StringBuilder& out, const FormatSpec& spec, std::size_t count) -> void {
+    if (spec.fill_len == 1) {
+        out.append(count, spec.fill[0]);
+        return;
+    }
+    for (; count > 0; --count) out.append(StringView(spec.fill, spec.fill_len));
+}
+
+/// 按对齐方式补齐到 spec.width 后追加 text，width 为 text 的码点数
+auto append_aligned(StringBuilder& out, StringView text, std::size_t width, const FormatSpec& spec,
+                    char default_align) -> void {
+    std::size_t total = (std::size_t)spec.width > width ? (std::size_t)spec.width - width : 0;
+    char align = spec.align ? spec.align : default_align;
+    std::size_t left = align == '>' ? total : align == '^' ? total / 2 : 0;
+    append_fill(out, spec, left);
+    out.append(text);
+    append_fill(out, spec, total - left);
+}
+
+/// 数值由 prefix（符号和进制前缀）和 body 组成，都是 ASCII。
+/// 指定了 0 而没有指定对齐方式时，0 补在前缀和 body 之间
+auto append_number(StringBuilder& out, StringView prefix, StringView body, const FormatSpec& spec) -> void {
+    std::size_t width = prefix.len() + body.len();
+    if (spec.zero_pad && spec.align == 0) {
+        out.append(prefix);
+        if ((std::size_t)spec.width > width) out.append((std::size_t)spec.width - width, '0');
+        out.append(body);
+        return;
+    }
+    std::size_t total = (std::size_t)spec.width > width ? (std::size_t)spec.width - width : 0;
+    char align = spec.align ? spec.align : '>';
+    std::size_t left = align == '>' ? total : align == '^' ? total / 2 : 0;
+    append_fill(out, spec, left);
+    out.append(prefix);
+    out.append(body);
+    append_fill(out, spec, total - left);
+}
+
+/// 非负数的符号：'+' 或 ' ' 时输出，'-' 时不输出
+auto sign_prefix(bool negative, const FormatSpec& spec, char* out) -> std::size_t {
+    if (negative) {
+        out[0] = '-';
+        return 1;
+    }
+    if (spec.sign == '+' || spec.sign == ' ') {
+        out[0] = spec.sign;
+        return 1;
+    }
+    return 0;
+}
+
+auto append_integer(StringBuilder& out, std::uint64_t magnitude, bool negative, const FormatSpec& spec) -> void {
+    if (spec.type == 'c') {
+        // 码点，负数和超出范围的值写为 U+FFFD
+        char text[4];
+        char32_t cp = negative || magnitude > 0x10FFFF ? (char32_t)0xFFFD : (char32_t)magnitude;
+        append_aligned(out, StringView(text, detail::utf8_encode(cp, text)), 1, spec, '>');
+        return;
+    }
+    char prefix[3];
+    std::size_t prefix_len = sign_prefix(negative, spec, prefix);
+    unsigned shift = 0;
+    switch (spec.type) {
+        case 'b': shift = 1; break;
+        case 'o': shift = 3; break;
+        case 'x':
+        case 'X': shift = 4; break;
+        default: break;
+    }
+    if (shift == 0) {
+        char digits[INT_CHARS_MAX];
+        append_number(out, StringView(prefix, prefix_len),
+                      StringView(digits, (std::size_t)(format_uint(magnitude, digits) - digits)), spec);
+        return;
+    }
+    if (spec.alternate) {
+        prefix[prefix_len++] = '0';
+        prefix[prefix_len++] = spec.type;
+    }
+    // 从低位向高位写
+    const char* alphabet = spec.type == 'X' ? "0123456789ABCDEF" : "0123456789abcdef";
+    char digits[64];
+    char* end = digits + sizeof(digits);
+    char* p = end;
+    do {
+        *--p = alphabet[magnitude & ((1u << shift) - 1)];
+        magnitude >>= shift;
+    } while (magnitude != 0);
+    append_number(out, StringView(prefix, prefix_len), StringView(p, (std::size_t)(end - p)), spec);
+}
+
+/// 非负有限值按 type 和 precision 写出，type 为 0 时 precision 一定已指定
+auto append_float_body(StringBuilder& out, StringView prefix, double magnitude, const FormatSpec& spec) -> void {
+    char type = spec.type;
+    int precision = spec.precision < 0 ? 6 : spec.precision;
+    bool percent = type == '%';
+    if (percent) {
+        magnitude *= 100;
+        type = 'f';
+    }
+    char stack[128];
+    char* body = stack;
+    std::size_t len = 0;
+    if ((type == 'f' || type == 'F') && !spec.alternate) {
+        if (char* end = detail::format_fixed(magnitude, precision, stack)) len = (std::size_t)(end - stack);
+    }
+    String heap;
+    if (len == 0) {
+        // 科学计数法、有效数字位数以及定点快速路径处理不了的值交给 snprintf
+        char conv[6] = {'%'};
+        std::size_t k = 1;
+        if (spec.alternate) conv[k++] = '#';
+        conv[k++] = '.';
+        conv[k++] = '*';
+        conv[k++] = type == 0 ? 'g' : type;
+        // 留出两个字节给后缀
+        int n = std::snprintf(stack, sizeof(stack) - 2, conv, precision, magnitude);
+        if (n < 0) return;
+        len = (std::size_t)n;
+        if (len >= sizeof(stack) - 2) {
+            heap.resize(len);
+            std::snprintf(heap.data(), len + 1, conv, precision, magnitude);
+            body = heap.data();
+        }
+    }
+    // 不指定类型时与 Python 相同，定点表示至少保留一位小数
+    const char* suffix = "";
+    if (type == 0 && std::string_view(body, len).find_first_of(".e") == std::string_view::npos) suffix = ".0";
+    if (percent) suffix = "%";
+    if (body == stack) {
+        for (; *suffix; ++suffix) stack[len++] = *suffix;
+    } else {
+        heap.append(suffix);
+        body = heap.data();
+        len = heap.len();
+    }
+    append_number(out, prefix, StringView(body, len), spec);
+}
+
+} // namespace
+
+auto StringBuilder::append(StringView text, const FormatSpec& spec) -> StringBuilder& {
+    if (spec.precision >= 0) {
+        // 最多保留 precision 个码点
+        std::size_t count = 0;
+        std::size_t i = 0;
+        for (; i < text.len(); ++i) {
+            if (((unsigned char)text.data()[i] & 0xC0) != 0x80 && count++ == (std::size_t)spec.precision) break;
+        }
+        text = StringView(text.data(), i);
+    }
+    std::size_t width = spec.width > 0 ? detail::utf8_count(text.data(), text.len()) : 0;
+    append_aligned(*this, text, width, spec, '<');
+    return *this;
+}
+
+auto StringBuilder::append(char ch, const FormatSpec& spec) -> StringBuilder& {
+    append_aligned(*this, StringView(&ch, 1), 1, spec, '<');
+    return *this;
+}
+
+auto StringBuilder::append_int(std::int64_t value, const FormatSpec& spec) -> StringBuilder& {
+    std::uint64_t magnitude = value < 0 ? 0 - (std::uint64_t)value : (std::uint64_t)value;
+    append_integer(*this, magnitude, value < 0, spec);
+    return *this;
+}
+
+auto StringBuilder::append_uint(std::uint64_t value, const FormatSpec& spec) -> StringBuilder& {
+    append_integer(*this, value, false, spec);
+    return *this;
+}
+
+auto StringBuilder::append_float(double value, const FormatSpec& spec) -> StringBuilder& {
+    // nan 不带符号
+    char prefix[1];
+    std::size_t prefix_len = sign_prefix(std::signbit(value) && !std::isnan(value), spec, prefix);
+    double magnitude = std::fabs(value);
+    bool upper = spec.type == 'E' || spec.type == 'F' || spec.type == 'G';
+    if (!std::isfinite(value)) {
+        const char* text = std::isnan(value) ? (upper ? "NAN" : "nan") : (upper ? "INF" : "inf");
+        char body[4] = {text[0], text[1], text[2], '%'};
+        append_number(*this, StringView(prefix, prefix_len), StringView(body, spec.type == '%' ? 4 : 3), spec);
+    } else if (spec.type == 0 && spec.precision < 0) {
+        char text[FLOAT_CHARS_MAX];
+        append_number(*this, StringView(prefix, prefix_len),
+                      StringView(text, (std::size_t)(format_float(magnitude, text) - text)), spec);
+    } else {
+        append_float_body(*this, StringView(prefix, prefix_len), magnitude, spec);
+    }
+    return *this;
+}
+
+auto StringBuilder::append_float(float value, const FormatSpec& spec) -> StringBuilder& {
+    if (spec.type != 0 || spec.precision >= 0 || !std::isfinite(value)) return append_float((double)value, spec);
+    // 按单精度取最短表示
+    char prefix[1];
+    std::size_t prefix_len = sign_prefix(std::signbit(value), spec, prefix);
+    char text[FLOAT_CHARS_MAX];
+    append_number(*this, StringView(prefix, prefix_len),
+                  StringView(text, (std::size_t)(format_float(std::fabs(value), text) - text)), spec);
+    return *this;
+}
+
+// ==================== 格式化 ====================
+
+auto StringBuilder::try_append_fmt_args(StringView fmt, const detail::FormatArg* args, SizeType count,
+                                        SizeType& used) -> const char* {
+    detail::FormatParser parser(std::string_view(fmt.data(), fmt.len()));
+    detail::FormatItem item;
+    while (parser.next(item)) {
+        buffer_.append(fmt.data() + item.begin, item.len);
+        if (!item.has_arg) continue;
+        if (item.arg >= count) return "not enough arguments for format";
+        if (!args[item.arg].write(*this, args[item.arg].value, item.spec)) {
+            return "format spec does not apply to the argument";
+        }
+    }
+    used = parser.args_used();
+    return parser.error();
+}
+
+auto StringBuilder::append_fmt_args(StringView fmt, const detail::FormatArg* args, SizeType count)
+    -> StringBuilder& {
+    SizeType used = 0;
+    // 只在失败时构造消息字符串
+    if (const char* error = try_append_fmt_args(fmt, args, count, used)) check(false, String("format error: ") + error);
+    if (used != count) check(false, "format error: too many arguments");
+    return *this;
+}
+
+// ==================== String::format ====================
+
+auto String::format_args(const detail::FormatArg* args, SizeType count) const -> Result<String, String> {
+    StringBuilder out(len());
+    SizeType used = 0;
+    if (const char* error = out.try_append_fmt_args(*this, args, count, used)) return err<String>(error);
+    return ok(out.finish());
+}
+
+auto String::format(const std::vector<String>& args) const -> Result<String, String> {
+    std::vector<detail::FormatArg> list;
+    list.reserve(args.size());
+    for (const String& arg : args) list.push_back(detail::FormatArg{&arg, &detail::write_format_arg<String>});
+    return format_args(list.data(), list.size());
+}
+
+} // namespace ks
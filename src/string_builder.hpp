@@ -0,0 +1,211 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <sstream>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "string.hpp"
+#include "string_view.hpp"
+#include "format.hpp"
+
+namespace ks {
+
+class Decimal;
+class StringBuilder;
+
+namespace detail {
+
+template<typename F, typename Tuple, std::size_t... I>
+auto write_compiled_format(StringBuilder& out, const Tuple& args, std::index_sequence<I...>) -> void;
+
+} // namespace detail
+
+/// 字符串构建器：在一块按两倍增长的缓冲区上追加内容，最后用 finish() 取出结果。
+/// 整数和浮点数直接写入缓冲区，不经过临时字符串；finish() 移交缓冲区，不拷贝
+class StringBuilder {
+    String buffer_;
+
+public:
+    using SizeType = std::size_t;
+
+    StringBuilder() = default;
+
+    /// 预留 capacity 字节，已知结果长度时可以只分配一次
+    explicit StringBuilder(SizeType capacity) { buffer_.reserve(capacity); }
+
+    /// 接管 buffer，在其原有内容之后继续追加，finish() 再把缓冲区交回，全程不拷贝
+    explicit StringBuilder(String&& buffer) : buffer_(std::move(buffer)) {}
+
+    // 容量
+    auto len() const -> SizeType { return buffer_.len(); }
+    auto empty() const -> bool { return buffer_.empty(); }
+    auto capacity() const -> SizeType { return buffer_.capacity(); }
+    auto reserve(SizeType new_cap) -> void { buffer_.reserve(new_cap); }
+    auto clear() -> void { buffer_.clear(); }
+
+    /// 已构建内容的视图，下一次追加后失效
+    auto view() const -> std::string_view { return buffer_.view(); }
+
+    // 追加
+    auto append(StringView text) -> StringBuilder& {
+        buffer_.append(text.data(), text.len());
+        return *this;
+    }
+    auto append(char ch) -> StringBuilder& {
+        buffer_.push_back(ch);
+        return *this;
+    }
+    auto append(SizeType count, char ch) -> StringBuilder& {
+        buffer_.append(count, ch);
+        return *this;
+    }
+
+    /// 十进制整数
+    auto append_int(std::int64_t value) -> StringBuilder&;
+    auto append_uint(std::uint64_t value) -> StringBuilder&;
+
+    /// 能解析回同一个值的最短表示，格式同 Python 的 repr（见 format_float）
+    auto append_float(double value) -> StringBuilder&;
+
+    /// 按单精度取最短表示，0.1f 写为 0.1
+    auto append_float(float value) -> StringBuilder&;
+
+    /// 定点小数，precision 为小数位数
+    auto append_float(double value, int precision) -> StringBuilder&;
+
+    /// 按格式说明追加（见 format.hpp），填充和对齐直接写入缓冲区，不产生临时字符串。
+    /// 调用方保证格式说明适用于该类型（detail::format_spec_supports）
+    auto append(StringView text, const FormatSpec& spec) -> StringBuilder&;
+    auto append(char ch, const FormatSpec& spec) -> StringBuilder&;
+    auto append_int(std::int64_t value, const FormatSpec& spec) -> StringBuilder&;
+    auto append_uint(std::uint64_t value, const FormatSpec& spec) -> StringBuilder&;
+    auto append_float(double value, const FormatSpec& spec) -> StringBuilder&;
+    auto append_float(float value, const FormatSpec& spec) -> StringBuilder&;
+
+    /// 高精度小数，定义在 decimal.cpp
+    auto append_decimal(const Decimal& value) -> StringBuilder&;
+
+    /// 按类型追加任意值：字符串类原样追加，char 追加字符，整数和浮点数按十进制，其他类型使用输出流
+    template<typename T>
+    auto append_value(const T& value) -> StringBuilder& {
+        if constexpr (std::is_same_v<T, char>) {
+            return append(value);
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            return append_int(value);
+        } else if constexpr (std::is_integral_v<T>) {
+            return append_uint(value);
+        } else if constexpr (std::is_same_v<T, float>) {
+            return append_float(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return append_float((double)value);
+        } else if constexpr (std::is_convertible_v<const T&, StringView>) {
+            return append(StringView(value));
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            return append(StringView(std::string_view(value)));
+        } else {
+            std::ostringstream oss;
+            oss << value;
+            auto text = oss.str();
+            return append(StringView(text.data(), text.size()));
+        }
+    }
+
+    /// 按格式说明追加任意值，分类同 append_value(value)；空的格式说明等同于 append_value(value)
+    template<typename T>
+    auto append_value(const T& value, const FormatSpec& spec) -> StringBuilder& {
+        if (spec.is_default()) return append_value(value);
+        if constexpr (std::is_same_v<T, char>) {
+            if (spec.type == 0 || spec.type == 'c' || spec.type == 's') return append(value, spec);
+            return append_int((unsigned char)value, spec);
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            return append_int(value, spec);
+        } else if constexpr (std::is_integral_v<T>) {
+            return append_uint(value, spec);
+        } else if constexpr (std::is_same_v<T, float>) {
+            return append_float(value, spec);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return append_float((double)value, spec);
+        } else if constexpr (std::is_convertible_v<const T&, StringView>) {
+            return append(StringView(value), spec);
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            return append(StringView(std::string_view(value)), spec);
+        } else {
+            std::ostringstream oss;
+            oss << value;
+            auto text = oss.str();
+            return append(StringView(text.data(), text.size()), spec);
+        }
+    }
+
+    /// 按 fmt 追加，语法见 format.hpp。格式错误、参数不足或多余、格式说明不适用于参数时终止程序
+    template<typename... Args>
+    auto append_fmt(StringView fmt, const Args&... args) -> StringBuilder& {
+        detail::FormatArg list[sizeof...(Args) + 1] = {
+            detail::FormatArg{&args, &detail::write_format_arg<Args>}...
+        };
+        return append_fmt_args(fmt, list, sizeof...(Args));
+    }
+
+    /// append_fmt 的非模板部分
+    auto append_fmt_args(StringView fmt, const detail::FormatArg* args, SizeType count) -> StringBuilder&;
+
+    /// append_fmt_args 的不终止版本：出错时返回错误消息（之前的内容可能已经写入），成功时返回 nullptr；
+    /// used 为格式字符串引用的参数个数
+    auto try_append_fmt_args(StringView fmt, const detail::FormatArg* args, SizeType count, SizeType& used)
+        -> const char*;
+
+    /// 按 KS_FMT 编译期解析好的格式追加，格式错误、参数数量不符或格式说明不适用于参数类型时编译失败
+    template<typename F, typename... Args, typename = std::enable_if_t<detail::IS_COMPILED_FORMAT<F>>>
+    auto append_fmt(F, const Args&... args) -> StringBuilder& {
+        using Format = detail::CompiledFormat<F>;
+        static_assert(Format::PARSED.error == nullptr, "format error: invalid format string");
+        static_assert(Format::PARSED.args == sizeof...(Args),
+                      "format error: number of arguments does not match the placeholders");
+        reserve(len() + Format::TEXT.size());
+        detail::write_compiled_format<F>(*this, std::forward_as_tuple(args...),
+                                         std::make_index_sequence<Format::PARSED.count>());
+        return *this;
+    }
+
+    /// 取出结果，不拷贝缓冲区；之后构建器为空，可以继续使用
+    auto finish() -> String { return std::move(buffer_); }
+};
+
+namespace detail {
+
+template<typename T>
+auto write_format_arg(StringBuilder& out, const void* value, const FormatSpec& spec) -> bool {
+    if (!format_spec_supports<T>(spec)) return false;
+    out.append_value(*static_cast<const T*>(value), spec);
+    return true;
+}
+
+template<typename F, std::size_t I, typename Tuple>
+auto write_format_item(StringBuilder& out, const Tuple& args) -> void {
+    constexpr FormatItem item = CompiledFormat<F>::PARSED.items[I];
+    if constexpr (item.len > 0) {
+        out.append(StringView(CompiledFormat<F>::TEXT.data() + item.begin, item.len));
+    }
+    if constexpr (item.has_arg) {
+        using T = std::remove_cv_t<std::remove_reference_t<std::tuple_element_t<item.arg, Tuple>>>;
+        static_assert(format_spec_supports<T>(item.spec), "format error: format spec does not apply to the argument");
+        if constexpr (item.spec.is_default()) {
+            out.append_value(std::get<item.arg>(args));
+        } else {
+            out.append_value(std::get<item.arg>(args), item.spec);
+        }
+    }
+}
+
+template<typename F, typename Tuple, std::size_t... I>
+auto write_compiled_format(StringBuilder& out, const Tuple& args, std::index_sequence<I...>) -> void {
+    (write_format_item<F, I>(out, args), ...);
+}
+
+} // namespace detail
+
+} // namespace ks
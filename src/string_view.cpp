@@ -0,0 +1,362 @@
+#include "string_view.hpp"
+#include "ascii.hpp"
+#include "unicode.hpp"
+#include "search.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace ks {
+
+// ==================== 构造函数 ====================
+
+StringView::StringView(const char* str) : data_(str ? str : ""), len_(str ? std::strlen(str) : 0) {}
+
+// ==================== 访问器 ====================
+
+auto StringView::at(SizeType index) const -> Result<char, String> {
+    if (index >= len_) {
+        return err<char>("index out of range");
+    }
+    return ok(data_[index]);
+}
+
+// ==================== 查找 / 判断类 ====================
+
+auto StringView::find(StringView sub) const -> std::int64_t {
+    auto pos = detail::search_find(data_, len_, sub.data(), sub.len());
+    return pos == npos ? -1 : static_cast<std::int64_t>(pos);
+}
+
+auto StringView::rfind(StringView sub) const -> std::int64_t {
+    auto pos = detail::search_rfind(data_, len_, sub.data(), sub.len());
+    return pos == npos ? -1 : static_cast<std::int64_t>(pos);
+}
+
+auto StringView::index(StringView sub) const -> Result<SizeType, String> {
+    auto pos = detail::search_find(data_, len_, sub.data(), sub.len());
+    if (pos == npos) {
+        return err<SizeType>("substring not found");
+    }
+    return ok(pos);
+}
+
+auto StringView::rindex(StringView sub) const -> Result<SizeType, String> {
+    auto pos = detail::search_rfind(data_, len_, sub.data(), sub.len());
+    if (pos == npos) {
+        return err<SizeType>("substring not found");
+    }
+    return ok(pos);
+}
+
+auto StringView::count(StringView sub) const -> SizeType {
+    return detail::search_count(*this, sub);
+}
+
+auto StringView::startswith(StringView prefix) const -> bool {
+    if (prefix.len() > len_) return false;
+    return view().compare(0, prefix.len(), prefix.view()) == 0;
+}
+
+auto StringView::endswith(StringView suffix) const -> bool {
+    if (suffix.len() > len_) return false;
+    return view().compare(len_ - suffix.len(), suffix.len(), suffix.view()) == 0;
+}
+
+auto StringView::isalpha() const -> bool {
+    if (empty()) return false;
+    return detail::unicode_all_of_class(data_, len_, detail::CharClass::Alpha);
+}
+
+auto StringView::isdigit() const -> bool {
+    if (empty()) return false;
+    return detail::unicode_all_of_class(data_, len_, detail::CharClass::Digit);
+}
+
+auto StringView::isalnum() const -> bool {
+    if (empty()) return false;
+    return detail::unicode_all_of_class(data_, len_, detail::CharClass::Alnum);
+}
+
+auto StringView::islower() const -> bool {
+    return detail::unicode_scan_case(data_, len_) == detail::CASE_HAS_LOWER;
+}
+
+auto StringView::isupper() const -> bool {
+    return detail::unicode_scan_case(data_, len_) == detail::CASE_HAS_UPPER;
+}
+
+auto StringView::isspace() const -> bool {
+    if (empty()) return false;
+    return detail::unicode_all_of_class(data_, len_, detail::CharClass::Space);
+}
+
+// ==================== 修剪 ====================
+
+auto StringView::is_whitespace(char c) -> bool {
+    return detail::WHITESPACE_SET.contains(c);
+}
+
+auto StringView::trim_left(StringView chars) const -> StringView {
+    return substr(detail::ByteSet(chars.view()).span_left(data_, len_));
+}
+
+auto StringView::trim_right(StringView chars) const -> StringView {
+    return substr(0, detail::ByteSet(chars.view()).span_right(data_, 0, len_));
+}
+
+auto StringView::strip() const -> StringView {
+    return lstrip().rstrip();
+}
+
+auto StringView::strip(StringView chars) const -> StringView {
+    detail::ByteSet set(chars.view());
+    SizeType start = set.span_left(data_, len_);
+    return substr(start, set.span_right(data_, start, len_) - start);
+}
+
+auto StringView::lstrip() const -> StringView {
+    SizeType start = 0;
+    while (start < len_ && is_whitespace(data_[start])) ++start;
+    return substr(start);
+}
+
+auto StringView::lstrip(StringView chars) const -> StringView {
+    return trim_left(chars);
+}
+
+auto StringView::rstrip() const -> StringView {
+    SizeType end = len_;
+    while (end > 0 && is_whitespace(data_[end - 1])) --end;
+    return substr(0, end);
+}
+
+auto StringView::rstrip(StringView chars) const -> StringView {
+    return trim_right(chars);
+}
+
+// ==================== 分割 ====================
+
+auto StringView::split(std::int64_t maxsplit) const -> std::vector<StringView> {
+    return split_iter(maxsplit).to_vector();
+}
+
+auto StringView::split(StringView sep, std::int64_t maxsplit) const -> std::vector<StringView> {
+    return split_iter(sep, maxsplit).to_vector();
+}
+
+auto StringView::rsplit(std::int64_t maxsplit) const -> std::vector<StringView> {
+    auto result = rsplit_iter(maxsplit).to_vector();
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+auto StringView::rsplit(StringView sep, std::int64_t maxsplit) const -> std::vector<StringView> {
+    auto result = rsplit_iter(sep, maxsplit).to_vector();
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+auto StringView::splitlines(bool keepends) const -> std::vector<StringView> {
+    std::vector<StringView> result;
+    SizeType start = 0;
+    SizeType end = 0;
+    while (end < len_) {
+        if (data_[end] == '\n' || data_[end] == '\r') {
+            // 处理 \r\n
+            SizeType eol_len = (data_[end] == '\r' && end + 1 < len_ && data_[end + 1] == '\n') ? 2 : 1;
+            result.push_back(substr(start, (keepends ? end + eol_len : end) - start));
+            end += eol_len;
+            start = end;
+        } else {
+            ++end;
+        }
+    }
+    if (start < len_) {
+        result.push_back(substr(start));
+    }
+    return result;
+}
+
+auto StringView::partition(StringView sep) const -> std::vector<StringView> {
+    auto pos = detail::search_find(data_, len_, sep.data(), sep.len());
+    if (pos == npos) {
+        return {*this, StringView(), StringView()};
+    }
+    return {substr(0, pos), substr(pos, sep.len()), substr(pos + sep.len())};
+}
+
+auto StringView::rpartition(StringView sep) const -> std::vector<StringView> {
+    auto pos = detail::search_rfind(data_, len_, sep.data(), sep.len());
+    if (pos == npos) {
+        return {StringView(), StringView(), *this};
+    }
+    return {substr(0, pos), substr(pos, sep.len()), substr(pos + sep.len())};
+}
+
+auto StringView::split_iter(std::int64_t maxsplit) const -> SplitRange {
+    return SplitRange(*this, StringView(), maxsplit, SplitRange::Mode::Whitespace, false, false);
+}
+
+auto StringView::split_iter(StringView sep, std::int64_t maxsplit) const -> SplitRange {
+    return SplitRange(*this, sep, maxsplit, SplitRange::Mode::Separator, false, false);
+}
+
+auto StringView::rsplit_iter(std::int64_t maxsplit) const -> SplitRange {
+    return SplitRange(*this, StringView(), maxsplit, SplitRange::Mode::Whitespace, true, false);
+}
+
+auto StringView::rsplit_iter(StringView sep, std::int64_t maxsplit) const -> SplitRange {
+    return SplitRange(*this, sep, maxsplit, SplitRange::Mode::Separator, true, false);
+}
+
+auto StringView::splitlines_iter(bool keepends) const -> SplitRange {
+    return SplitRange(*this, StringView(), -1, SplitRange::Mode::Lines, false, keepends);
+}
+
+// ==================== 其他实用 ====================
+
+auto StringView::substr(SizeType pos, SizeType count) const -> StringView {
+    if (pos > len_) return StringView();
+    if (count == npos || pos + count > len_) {
+        count = len_ - pos;
+    }
+    return StringView(data_ + pos, count);
+}
+
+// ==================== String 惰性拆分 ====================
+
+auto String::split_iter(std::int64_t maxsplit) const& -> SplitRange {
+    return StringView(*this).split_iter(maxsplit);
+}
+
+auto String::split_iter(StringView sep, std::int64_t maxsplit) const& -> SplitRange {
+    return StringView(*this).split_iter(sep, maxsplit);
+}
+
+auto String::rsplit_iter(std::int64_t maxsplit) const& -> SplitRange {
+    return StringView(*this).rsplit_iter(maxsplit);
+}
+
+auto String::rsplit_iter(StringView sep, std::int64_t maxsplit) const& -> SplitRange {
+    return StringView(*this).rsplit_iter(sep, maxsplit);
+}
+
+auto String::splitlines_iter(bool keepends) const& -> SplitRange {
+    return StringView(*this).splitlines_iter(keepends);
+}
+
+// ==================== SplitRange ====================
+
+SplitRange::Iterator::Iterator(const SplitRange& range)
+    : rest_(range.text_), sep_(range.sep_), splits_left_(range.maxsplit_), mode_(range.mode_),
+      reverse_(range.reverse_), keepends_(range.keepends_), last_(false), done_(false) {
+    advance();
+}
+
+auto SplitRange::Iterator::advance() -> void {
+    if (done_) return;
+    if (last_) {
+        done_ = true;
+        return;
+    }
+    switch (mode_) {
+        case Mode::Separator: advance_separator(); break;
+        case Mode::Whitespace: advance_whitespace(); break;
+        case Mode::Lines: advance_lines(); break;
+    }
+}
+
+auto SplitRange::Iterator::advance_separator() -> void {
+    auto sep = sep_.view();
+    if (sep.empty()) {
+        // 与 String::split 一致：空分隔符按字符拆分
+        if (rest_.empty()) {
+            done_ = true;
+            return;
+        }
+        if (splits_left_ == 0 || rest_.len() == 1) {
+            current_ = rest_;
+            last_ = true;
+            return;
+        }
+        if (reverse_) {
+            current_ = rest_.substr(rest_.len() - 1);
+            rest_ = rest_.substr(0, rest_.len() - 1);
+        } else {
+            current_ = rest_.substr(0, 1);
+            rest_ = rest_.substr(1);
+        }
+    } else {
+        auto pos = splits_left_ == 0 ? StringView::npos
+                 : reverse_ ? detail::search_rfind(rest_.data(), rest_.len(), sep.data(), sep.len())
+                 : detail::search_find(rest_.data(), rest_.len(), sep.data(), sep.len());
+        if (pos == StringView::npos) {
+            current_ = rest_;
+            last_ = true;
+            return;
+        }
+        if (reverse_) {
+            current_ = rest_.substr(pos + sep.len());
+            rest_ = rest_.substr(0, pos);
+        } else {
+            current_ = rest_.substr(0, pos);
+            rest_ = rest_.substr(pos + sep.len());
+        }
+    }
+    if (splits_left_ > 0) --splits_left_;
+}
+
+auto SplitRange::Iterator::advance_whitespace() -> void {
+    rest_ = reverse_ ? rest_.rstrip() : rest_.lstrip();
+    if (rest_.empty()) {
+        done_ = true;
+        return;
+    }
+    if (splits_left_ == 0) {
+        // 拆分次数用完：剩余部分整体作为最后一个字段（另一侧的空白保留）
+        current_ = rest_;
+        last_ = true;
+        return;
+    }
+    auto is_space = [](char c) { return detail::WHITESPACE_SET.contains(c); };
+    if (reverse_) {
+        SizeType start = rest_.len();
+        while (start > 0 && !is_space(rest_[start - 1])) --start;
+        current_ = rest_.substr(start);
+        rest_ = rest_.substr(0, start);
+    } else {
+        SizeType end = 0;
+        while (end < rest_.len() && !is_space(rest_[end])) ++end;
+        current_ = rest_.substr(0, end);
+        rest_ = rest_.substr(end);
+    }
+    if (splits_left_ > 0) --splits_left_;
+}
+
+auto SplitRange::Iterator::advance_lines() -> void {
+    if (rest_.empty()) {
+        done_ = true;
+        return;
+    }
+    SizeType end = 0;
+    while (end < rest_.len() && rest_[end] != '\n' && rest_[end] != '\r') ++end;
+    if (end == rest_.len()) {
+        current_ = rest_;
+        last_ = true;
+        return;
+    }
+    // 处理 \r\n
+    SizeType eol_len = (rest_[end] == '\r' && end + 1 < rest_.len() && rest_[end + 1] == '\n') ? 2 : 1;
+    current_ = rest_.substr(0, keepends_ ? end + eol_len : end);
+    rest_ = rest_.substr(end + eol_len);
+}
+
+auto SplitRange::to_vector() const -> std::vector<StringView> {
+    std::vector<StringView> result;
+    for (auto field : *this) {
+        result.push_back(field);
+    }
+    return result;
+}
+
+} // namespace ks
@@ -0,0 +1,285 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <vector>
+#include <iterator>
+
+#include "string.hpp"
+
+namespace ks {
+
+class SplitRange;
+class CharRange;
+
+/// 不持有内存的只读字符串视图，提供与 ks::String 相同风格的查找、判断、修剪和分割方法。
+/// 修剪和分割的结果仍然是指向原字符串的视图，不分配任何字符串。
+/// 视图不保证以 '\0' 结尾，且在被引用的字符串销毁或修改后失效
+class StringView {
+    const char* data_;
+    std::size_t len_;
+
+public:
+    // 类型定义
+    using SizeType = std::size_t;
+    using ConstIterator = const char*;
+
+    // 构造函数
+    StringView() : data_(""), len_(0) {}
+    StringView(const char* str);
+    StringView(const char* str, SizeType len) : data_(str), len_(len) {}
+    StringView(const String& str) : data_(str.c_str()), len_(str.len()) {}
+    explicit StringView(std::string_view sv) : data_(sv.data()), len_(sv.size()) {}
+
+    // 转换
+    auto view() const -> std::string_view { return std::string_view(data_, len_); }
+    auto to_string() const -> String { return String(view()); }
+
+    // 访问器
+    auto data() const -> const char* { return data_; }
+    auto operator[](SizeType index) const -> const char& { return data_[index]; }
+    auto at(SizeType index) const -> Result<char, String>;
+
+    // 迭代器
+    auto begin() const -> ConstIterator { return data_; }
+    auto end() const -> ConstIterator { return data_ + len_; }
+
+    // 容量
+    auto len() const -> SizeType { return len_; }
+    auto empty() const -> bool { return len_ == 0; }
+
+    // 比较
+    auto operator==(StringView other) const -> bool { return view() == other.view(); }
+    auto operator!=(StringView other) const -> bool { return view() != other.view(); }
+    auto operator<(StringView other) const -> bool { return view() < other.view(); }
+    auto operator<=(StringView other) const -> bool { return view() <= other.view(); }
+    auto operator>(StringView other) const -> bool { return view() > other.view(); }
+    auto operator>=(StringView other) const -> bool { return view() >= other.view(); }
+
+    // ---------- 查找 / 判断类 ----------
+
+    /// 查找子串，返回索引，没找到返回 -1
+    auto find(StringView sub) const -> std::int64_t;
+
+    /// 从右查找子串
+    auto rfind(StringView sub) const -> std::int64_t;
+
+    /// 查找索引，返回 Result
+    auto index(StringView sub) const -> Result<SizeType, String>;
+
+    /// 从右查找索引
+    auto rindex(StringView sub) const -> Result<SizeType, String>;
+
+    /// 子串出现次数
+    auto count(StringView sub) const -> SizeType;
+
+    /// 是否以...开头
+    auto startswith(StringView prefix) const -> bool;
+
+    /// 是否以...结尾
+    auto endswith(StringView suffix) const -> bool;
+
+    /// 是否全字母
+    auto isalpha() const -> bool;
+
+    /// 是否全数字
+    auto isdigit() const -> bool;
+
+    /// 是否字母/数字
+    auto isalnum() const -> bool;
+
+    /// 是否全小写
+    auto islower() const -> bool;
+
+    /// 是否全大写
+    auto isupper() const -> bool;
+
+    /// 是否空白字符
+    auto isspace() const -> bool;
+
+    /// 逐个码点遍历（定义在 utf8.cpp）
+    auto chars() const -> CharRange;
+
+    // ---------- 数值转换（定义在 charconv.cpp） ----------
+
+    /// 转换为整数，允许首尾空白
+    auto to_int() const -> Result<std::int64_t, String>;
+
+    /// 转换为浮点数，允许首尾空白
+    auto to_float() const -> Result<double, String>;
+
+    // ---------- 修剪 ----------
+
+    /// 去两边空白
+    auto strip() const -> StringView;
+    auto strip(StringView chars) const -> StringView;
+
+    /// 去左边空白
+    auto lstrip() const -> StringView;
+    auto lstrip(StringView chars) const -> StringView;
+
+    /// 去右边空白
+    auto rstrip() const -> StringView;
+    auto rstrip(StringView chars) const -> StringView;
+
+    // ---------- 分割 ----------
+
+    /// 按分隔符拆成视图列表，maxsplit 为最多拆分次数，负数表示不限制
+    auto split(std::int64_t maxsplit = -1) const -> std::vector<StringView>;  // 默认按空白分割
+    auto split(StringView sep, std::int64_t maxsplit = -1) const -> std::vector<StringView>;
+
+    /// 从右拆，结果按从左到右的顺序排列
+    auto rsplit(std::int64_t maxsplit = -1) const -> std::vector<StringView>;
+    auto rsplit(StringView sep, std::int64_t maxsplit = -1) const -> std::vector<StringView>;
+
+    /// 按换行拆
+    auto splitlines(bool keepends = false) const -> std::vector<StringView>;
+
+    /// 分成 (前, sep, 后) 三元组
+    auto partition(StringView sep) const -> std::vector<StringView>;
+
+    /// 从右 partition
+    auto rpartition(StringView sep) const -> std::vector<StringView>;
+
+    /// 惰性拆分：返回可用于范围 for 的区间，迭代时才逐个产生字段，可随时提前停止。
+    /// maxsplit 为最多拆分次数，负数表示不限制，语义与 Python 相同。
+    /// 迭代期间被拆分的文本必须保持有效；超过 SplitRange::SEP_INLINE_CAPACITY 字节的 sep 也必须保持有效
+    auto split_iter(std::int64_t maxsplit = -1) const -> SplitRange;  // 默认按空白分割
+    auto split_iter(StringView sep, std::int64_t maxsplit = -1) const -> SplitRange;
+
+    /// 惰性从右拆：字段按从右到左的顺序产生
+    auto rsplit_iter(std::int64_t maxsplit = -1) const -> SplitRange;
+    auto rsplit_iter(StringView sep, std::int64_t maxsplit = -1) const -> SplitRange;
+
+    /// 惰性按换行拆
+    auto splitlines_iter(bool keepends = false) const -> SplitRange;
+
+    // ---------- 其他实用 ----------
+
+    /// 获取子视图
+    auto substr(SizeType pos = 0, SizeType count = npos) const -> StringView;
+
+    /// 静态常量
+    static const SizeType npos = static_cast<SizeType>(-1);
+
+private:
+    /// 检查字符是否为空白
+    static auto is_whitespace(char c) -> bool;
+
+    /// 修剪辅助函数
+    auto trim_left(StringView chars) const -> StringView;
+    auto trim_right(StringView chars) const -> StringView;
+};
+
+/// split_iter / rsplit_iter / splitlines_iter 返回的惰性区间。
+/// 只保存被拆分文本的视图，迭代过程不分配内存，文本在迭代期间必须保持有效。
+/// 不超过 SEP_INLINE_CAPACITY 字节的分隔符复制到区间和迭代器内，可以是临时对象；
+/// 更长的分隔符只保存视图，同样必须在迭代期间保持有效
+class SplitRange {
+public:
+    using SizeType = StringView::SizeType;
+
+    /// 拆分方式
+    enum class Mode { Separator, Whitespace, Lines };
+
+    /// 内联保存的分隔符最大长度
+    static constexpr SizeType SEP_INLINE_CAPACITY = 16;
+
+private:
+    /// 分隔符：短的复制到内联缓冲区，长的引用外部数据。不保存指向自身的指针，可以直接拷贝
+    class Separator {
+        const char* external_;   // 为 nullptr 时使用 inline_
+        SizeType len_;
+        char inline_[SEP_INLINE_CAPACITY];
+
+    public:
+        Separator() : external_(nullptr), len_(0), inline_() {}
+
+        explicit Separator(StringView sep) : external_(nullptr), len_(sep.len()), inline_() {
+            if (len_ <= SEP_INLINE_CAPACITY) {
+                if (len_ > 0) std::memcpy(inline_, sep.data(), len_);
+            } else {
+                external_ = sep.data();
+            }
+        }
+
+        auto view() const -> StringView { return StringView(external_ ? external_ : inline_, len_); }
+    };
+
+    StringView text_;
+    Separator sep_;
+    std::int64_t maxsplit_;
+    Mode mode_;
+    bool reverse_;
+    bool keepends_;
+
+public:
+    class Iterator {
+        StringView rest_;        // 尚未拆分的部分
+        StringView current_;     // 当前字段
+        Separator sep_;
+        std::int64_t splits_left_;
+        Mode mode_;
+        bool reverse_;
+        bool keepends_;
+        bool last_;              // 当前字段是否为最后一个
+        bool done_;              // 是否已到达末尾
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = StringView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const StringView*;
+        using reference = const StringView&;
+
+        /// 构造末尾迭代器
+        Iterator()
+            : splits_left_(0), mode_(Mode::Separator), reverse_(false), keepends_(false), last_(true), done_(true) {}
+        explicit Iterator(const SplitRange& range);
+
+        auto operator*() const -> reference { return current_; }
+        auto operator->() const -> pointer { return &current_; }
+
+        auto operator++() -> Iterator& {
+            advance();
+            return *this;
+        }
+
+        auto operator++(int) -> Iterator {
+            auto tmp = *this;
+            advance();
+            return tmp;
+        }
+
+        friend auto operator==(const Iterator& a, const Iterator& b) -> bool {
+            if (a.done_ || b.done_) return a.done_ == b.done_;
+            return a.current_.data() == b.current_.data() && a.current_.len() == b.current_.len();
+        }
+
+        friend auto operator!=(const Iterator& a, const Iterator& b) -> bool {
+            return !(a == b);
+        }
+
+    private:
+        auto advance() -> void;
+        auto advance_separator() -> void;
+        auto advance_whitespace() -> void;
+        auto advance_lines() -> void;
+    };
+
+    SplitRange(StringView text, StringView sep, std::int64_t maxsplit, Mode mode, bool reverse, bool keepends)
+        : text_(text), sep_(sep), maxsplit_(maxsplit), mode_(mode), reverse_(reverse), keepends_(keepends) {}
+
+    auto begin() const -> Iterator { return Iterator(*this); }
+    auto end() const -> Iterator { return Iterator(); }
+
+    /// 把所有字段收集为列表
+    auto to_vector() const -> std::vector<StringView>;
+};
+
+} // namespace ks
+
+// String::format 的模板实例化时需要 detail::write_format_arg 的定义，放在末尾包含以保证 String 和 StringView 完整
+#include "string_builder.hpp"
@@ -0,0 +1,278 @@
+#include "unicode.hpp"
+#include "string.hpp"
+#include "utf8.hpp"
+#include <algorithm>
+
+namespace ks {
+namespace detail {
+
+namespace {
+
+enum class Mapping { Lower, Upper, Title };
+
+auto full_mapping(char32_t cp, Mapping which, char32_t out[3]) -> std::size_t {
+    const CharRecord& record = char_record(cp);
+    if (record.special != 0) {
+        const SpecialCasing& special = SPECIAL_CASING[record.special];
+        const char32_t* mapped = which == Mapping::Lower ? special.lower
+                               : which == Mapping::Upper ? special.upper
+                               : special.title;
+        std::size_t n = 0;
+        while (n < 3 && mapped[n] != 0) {
+            out[n] = mapped[n];
+            ++n;
+        }
+        return n;
+    }
+    std::int32_t delta = which == Mapping::Lower ? record.lower
+                       : which == Mapping::Upper ? record.upper
+                       : record.title;
+    out[0] = (char32_t)((std::int32_t)cp + delta);
+    return 1;
+}
+
+inline auto is_ascii(char c) -> bool {
+    return (unsigned char)c < 0x80;
+}
+
+/// 解码 data[pos] 开始的码点并移动 pos；不是合法 UTF-8 时返回 false，pos 只前进一个字节
+inline auto next_code_point(const char* data, std::size_t len, std::size_t& pos, char32_t& cp) -> bool {
+    std::size_t start = pos;
+    cp = utf8_decode(data, len, pos);
+    return cp != REPLACEMENT_CHAR || pos - start != 1;
+}
+
+inline auto class_flags(CharClass cls) -> unsigned {
+    switch (cls) {
+        case CharClass::Alpha: return CHAR_ALPHA;
+        case CharClass::Digit: return CHAR_DIGIT;
+        case CharClass::Alnum: return CHAR_ALPHA | CHAR_NUMERIC;
+        case CharClass::Space: return CHAR_SPACE;
+    }
+    return 0;
+}
+
+/// 位于 [start, end) 的 Σ 是否处在词尾：前面（跳过可忽略字符）是有大小写的字符，后面不是（Unicode 3.13 节 Final_Sigma）
+auto is_final_sigma(const char* data, std::size_t len, std::size_t start, std::size_t end) -> bool {
+    bool cased_before = false;
+    for (std::size_t pos = start; pos > 0; ) {
+        std::size_t prev = pos - 1;
+        while (prev > 0 && pos - prev < 4 && ((unsigned char)data[prev] & 0xC0) == 0x80) --prev;
+        std::size_t next = prev;
+        unsigned flags = char_flags(utf8_decode(data, len, next));
+        pos = prev;
+        if (flags & CHAR_CASE_IGNORABLE) continue;
+        cased_before = (flags & CHAR_CASED) != 0;
+        break;
+    }
+    if (!cased_before) return false;
+    for (std::size_t pos = end; pos < len; ) {
+        unsigned flags = char_flags(utf8_decode(data, len, pos));
+        if (flags & CHAR_CASE_IGNORABLE) continue;
+        return (flags & CHAR_CASED) == 0;
+    }
+    return true;
+}
+
+/// 小写映射，Σ 按上下文选择 σ 或 ς
+auto lower_in_context(const char* data, std::size_t len, std::size_t start, std::size_t end, char32_t cp,
+                      char32_t out[3]) -> std::size_t {
+    if (cp == 0x03A3) {
+        out[0] = is_final_sigma(data, len, start, end) ? 0x03C2 : 0x03C3;
+        return 1;
+    }
+    return full_mapping(cp, Mapping::Lower, out);
+}
+
+/// 大小写转换的输出缓冲区：按两倍增长，结果长度可能与输入不同
+class CaseWriter {
+    String out_;
+    std::size_t size_ = 0;
+
+public:
+    explicit CaseWriter(std::size_t capacity) : out_(capacity, '\0') {}
+
+    /// 保证尾部至少有 n 字节可写，返回写入位置
+    auto reserve(std::size_t n) -> char* {
+        if (size_ + n > out_.len()) out_.resize(std::max(out_.len() * 2, size_ + n));
+        return out_.data() + size_;
+    }
+
+    auto commit(std::size_t n) -> void { size_ += n; }
+
+    auto put_byte(char c) -> void {
+        *reserve(1) = c;
+        ++size_;
+    }
+
+    auto put(const char32_t* cps, std::size_t n) -> void {
+        char* dst = reserve(n * 4);
+        std::size_t written = 0;
+        for (std::size_t i = 0; i < n; ++i) written += utf8_encode(cps[i], dst + written);
+        size_ += written;
+    }
+
+    auto finish() -> String {
+        out_.resize(size_);
+        return std::move(out_);
+    }
+};
+
+/// 从 pos 开始按 op 转换到结尾：ASCII 段走向量化内核，其余按码点查表
+auto convert_from(CaseWriter& out, const char* data, std::size_t len, std::size_t pos, CaseOp op) -> void {
+    while (pos < len) {
+        std::size_t n = ascii_convert_case(data + pos, out.reserve(len - pos), len - pos, op);
+        out.commit(n);
+        pos += n;
+        while (pos < len && !is_ascii(data[pos])) {
+            std::size_t start = pos;
+            char32_t cp;
+            if (!next_code_point(data, len, pos, cp)) {
+                out.put_byte(data[start]);
+                continue;
+            }
+            char32_t mapped[3];
+            std::size_t count = 1;
+            mapped[0] = cp;
+            switch (op) {
+                case CaseOp::Lower:
+                    count = lower_in_context(data, len, start, pos, cp, mapped);
+                    break;
+                case CaseOp::Upper:
+                    count = full_mapping(cp, Mapping::Upper, mapped);
+                    break;
+                case CaseOp::Swap: {
+                    unsigned flags = char_flags(cp);
+                    if (flags & CHAR_UPPER) {
+                        count = lower_in_context(data, len, start, pos, cp, mapped);
+                    } else if (flags & CHAR_LOWER) {
+                        count = full_mapping(cp, Mapping::Upper, mapped);
+                    }
+                    break;
+                }
+            }
+            out.put(mapped, count);
+        }
+    }
+}
+
+} // namespace
+
+auto char_to_lower(char32_t cp, char32_t out[3]) -> std::size_t {
+    return full_mapping(cp, Mapping::Lower, out);
+}
+
+auto char_to_upper(char32_t cp, char32_t out[3]) -> std::size_t {
+    return full_mapping(cp, Mapping::Upper, out);
+}
+
+auto char_to_title(char32_t cp, char32_t out[3]) -> std::size_t {
+    return full_mapping(cp, Mapping::Title, out);
+}
+
+auto unicode_all_of_class(const char* data, std::size_t len, CharClass cls) -> bool {
+    unsigned want = class_flags(cls);
+    std::size_t pos = 0;
+    while (true) {
+        pos += ascii_span_of_class(data + pos, len - pos, cls);
+        if (pos == len) return true;
+        if (is_ascii(data[pos])) return false;
+        do {
+            char32_t cp;
+            if (!next_code_point(data, len, pos, cp) || !(char_flags(cp) & want)) return false;
+        } while (pos < len && !is_ascii(data[pos]));
+    }
+}
+
+auto unicode_scan_case(const char* data, std::size_t len) -> unsigned {
+    constexpr unsigned BOTH = CASE_HAS_LOWER | CASE_HAS_UPPER;
+    unsigned result = 0;
+    std::size_t pos = 0;
+    while (pos < len) {
+        pos += ascii_scan_case(data + pos, len - pos, result);
+        if (result == BOTH) return result;
+        while (pos < len && !is_ascii(data[pos])) {
+            char32_t cp;
+            if (!next_code_point(data, len, pos, cp)) continue;
+            unsigned flags = char_flags(cp);
+            if (flags & (CHAR_LOWER | CHAR_TITLE)) result |= CASE_HAS_LOWER;
+            if (flags & (CHAR_UPPER | CHAR_TITLE)) result |= CASE_HAS_UPPER;
+        }
+        if (result == BOTH) return result;
+    }
+    return result;
+}
+
+auto unicode_convert_case(const char* data, std::size_t len, CaseOp op) -> String {
+    CaseWriter out(len);
+    convert_from(out, data, len, 0, op);
+    return out.finish();
+}
+
+auto unicode_title(const char* data, std::size_t len) -> String {
+    CaseWriter out(len);
+    bool previous_cased = false;
+    for (std::size_t pos = 0; pos < len; ) {
+        char c = data[pos];
+        if (is_ascii(c)) {
+            bool upper = c >= 'A' && c <= 'Z';
+            bool lower = c >= 'a' && c <= 'z';
+            if (previous_cased && upper) c = (char)(c | 0x20);
+            if (!previous_cased && lower) c = (char)(c & ~0x20);
+            out.put_byte(c);
+            previous_cased = upper || lower;
+            ++pos;
+            continue;
+        }
+        std::size_t start = pos;
+        char32_t cp;
+        if (!next_code_point(data, len, pos, cp)) {
+            out.put_byte(data[start]);
+            previous_cased = false;
+            continue;
+        }
+        char32_t mapped[3];
+        std::size_t count = previous_cased ? lower_in_context(data, len, start, pos, cp, mapped)
+                                           : full_mapping(cp, Mapping::Title, mapped);
+        out.put(mapped, count);
+        previous_cased = (char_flags(cp) & CHAR_CASED) != 0;
+    }
+    return out.finish();
+}
+
+auto unicode_capitalize(const char* data, std::size_t len) -> String {
+    CaseWriter out(len);
+    if (len == 0) return out.finish();
+    std::size_t pos = 0;
+    char32_t cp;
+    if (next_code_point(data, len, pos, cp)) {
+        char32_t mapped[3];
+        out.put(mapped, full_mapping(cp, Mapping::Title, mapped));
+    } else {
+        out.put_byte(data[0]);
+    }
+    convert_from(out, data, len, pos, CaseOp::Lower);
+    return out.finish();
+}
+
+auto unicode_istitle(const char* data, std::size_t len) -> bool {
+    bool cased = false;
+    bool previous_cased = false;
+    for (std::size_t pos = 0; pos < len; ) {
+        char32_t cp;
+        unsigned flags = next_code_point(data, len, pos, cp) ? char_flags(cp) : 0;
+        if (flags & (CHAR_UPPER | CHAR_TITLE)) {
+            if (previous_cased) return false;
+            previous_cased = cased = true;
+        } else if (flags & CHAR_LOWER) {
+            if (!previous_cased) return false;
+            previous_cased = cased = true;
+        } else {
+            previous_cased = false;
+        }
+    }
+    return cased;
+}
+
+} // namespace detail
+} // namespace ks
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "ascii.hpp"
+
+namespace ks {
+
+class String;
+
+namespace detail {
+
+// ==================== Unicode 属性表 ====================
+// 表由 tools/gen_unicode_data.py 生成到 unicode_data.cpp，与进程的 locale 无关。
+// 两级查找：CHAR_STAGE1[cp >> UNICODE_BLOCK_SHIFT] 给出块号，
+// CHAR_STAGE2[块号 * 块大小 + 块内偏移] 给出 CHAR_RECORDS 的下标；内容相同的块只存一份
+
+/// 字符属性位
+enum CharFlag : std::uint16_t {
+    CHAR_ALPHA = 1 << 0,           // str.isalpha
+    CHAR_DIGIT = 1 << 1,           // str.isdigit
+    CHAR_NUMERIC = 1 << 2,         // str.isnumeric
+    CHAR_SPACE = 1 << 3,           // str.isspace
+    CHAR_LOWER = 1 << 4,           // Lowercase
+    CHAR_UPPER = 1 << 5,           // Uppercase
+    CHAR_TITLE = 1 << 6,           // 标题大小写字母（Lt）
+    CHAR_CASED = 1 << 7,           // 有大小写之分
+    CHAR_CASE_IGNORABLE = 1 << 8,  // 判断词首、词尾时跳过
+};
+
+/// 一类字符共用的属性记录
+struct CharRecord {
+    std::int32_t lower;     // 简单映射相对码点的差值
+    std::int32_t upper;
+    std::int32_t title;
+    std::uint16_t flags;
+    std::uint16_t special;  // 非 0 时映射为一对多，取 SPECIAL_CASING[special]
+};
+
+/// 一对多的完整大小写映射（如 ß -> SS），不足 3 个码点时以 0 结尾
+struct SpecialCasing {
+    char32_t lower[3];
+    char32_t upper[3];
+    char32_t title[3];
+};
+
+constexpr unsigned UNICODE_BLOCK_SHIFT = 8;
+
+extern const CharRecord CHAR_RECORDS[];
+extern const SpecialCasing SPECIAL_CASING[];
+extern const std::uint8_t CHAR_STAGE1[];
+extern const std::uint16_t CHAR_STAGE2[];
+
+inline auto char_record(char32_t cp) -> const CharRecord& {
+    if (cp > 0x10FFFF) cp = 0;
+    std::uint32_t block = CHAR_STAGE1[cp >> UNICODE_BLOCK_SHIFT];
+    return CHAR_RECORDS[CHAR_STAGE2[(block << UNICODE_BLOCK_SHIFT) + (cp & ((1u << UNICODE_BLOCK_SHIFT) - 1))]];
+}
+
+inline auto char_flags(char32_t cp) -> unsigned { return char_record(cp).flags; }
+
+/// 完整大小写映射，结果写入 out，返回码点个数（1 到 3）
+auto char_to_lower(char32_t cp, char32_t out[3]) -> std::size_t;
+auto char_to_upper(char32_t cp, char32_t out[3]) -> std::size_t;
+auto char_to_title(char32_t cp, char32_t out[3]) -> std::size_t;
+
+// ==================== 按字符串处理 ====================
+// ASCII 部分交给 ascii.cpp 的向量化内核，遇到非 ASCII 字节时按码点查表。
+// 不是合法 UTF-8 的字节不属于任何类别，转换时原样保留
+
+/// 是否所有码点都属于指定类别（空串返回 true，由调用方处理空串语义）
+auto unicode_all_of_class(const char* data, std::size_t len, CharClass cls) -> bool;
+
+/// 扫描有大小写之分的字符，返回 CASE_HAS_LOWER / CASE_HAS_UPPER 的组合；
+/// 标题大小写字母（如 ǅ）同时计入两者
+auto unicode_scan_case(const char* data, std::size_t len) -> unsigned;
+
+/// 按 op 转换大小写后返回新字符串，结果的字节数可能与原串不同（如 ß -> SS）
+auto unicode_convert_case(const char* data, std::size_t len, CaseOp op) -> String;
+
+/// 每个词的首字母转为标题大小写、其余转为小写；词由连续的有大小写之分的字符组成
+auto unicode_title(const char* data, std::size_t len) -> String;
+
+/// 首字符转为标题大小写，其余转为小写
+auto unicode_capitalize(const char* data, std::size_t len) -> String;
+
+/// 是否为标题格式：大写和标题大小写字母只出现在词首，小写字母只出现在词中，且至少有一个
+auto unicode_istitle(const char* data, std::size_t len) -> bool;
+
+} // namespace detail
+} // namespace ks
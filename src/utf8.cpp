@@ -0,0 +1,443 @@
+#include "utf8.hpp"
+#include "bits.hpp"
+#include <cstring>
+
+#if !defined(KS_DISABLE_SIMD) && (defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__)))
+    #define KS_UTF8_SSE2 1
+    #include <emmintrin.h>
+    // AVX2 内核通过函数级 target 属性单独编译，不要求整个项目开启 -mavx2
+    #if defined(__GNUC__)
+        #define KS_UTF8_AVX2 1
+        #define KS_TARGET_AVX2 __attribute__((target("avx2")))
+        #include <immintrin.h>
+    #endif
+#endif
+
+namespace ks {
+namespace detail {
+
+namespace {
+
+// ==================== 标量实现 ====================
+
+inline auto in_range(unsigned char c, unsigned char lo, unsigned char hi) -> bool {
+    return (unsigned char)(c - lo) <= (unsigned char)(hi - lo);
+}
+
+/// 校验 s[pos] 开始的多字节序列（首字节 >= 0x80），合法时返回长度，否则返回 0。
+/// 各首字节允许的第二字节范围见 Unicode 标准表 3-7
+auto sequence_length(const unsigned char* s, std::size_t len, std::size_t pos) -> std::size_t {
+    unsigned char c = s[pos];
+    std::size_t n;
+    unsigned char lo = 0x80;
+    unsigned char hi = 0xBF;
+    if (in_range(c, 0xC2, 0xDF)) {
+        n = 2;
+    } else if (in_range(c, 0xE0, 0xEF)) {
+        n = 3;
+        if (c == 0xE0) lo = 0xA0;       // 过长编码
+        if (c == 0xED) hi = 0x9F;       // 代理项
+    } else if (in_range(c, 0xF0, 0xF4)) {
+        n = 4;
+        if (c == 0xF0) lo = 0x90;       // 过长编码
+        if (c == 0xF4) hi = 0x8F;       // 超过 U+10FFFF
+    } else {
+        return 0;
+    }
+    if (len - pos < n) return 0;
+    if (!in_range(s[pos + 1], lo, hi)) return 0;
+    for (std::size_t i = 2; i < n; ++i) {
+        if (!in_range(s[pos + i], 0x80, 0xBF)) return 0;
+    }
+    return n;
+}
+
+/// 从 pos 开始校验，返回第一个非法序列的位置；按 8 字节（SSE2 下 16 字节）整块跳过 ASCII
+auto scalar_error_offset(const unsigned char* s, std::size_t len, std::size_t pos) -> std::size_t {
+    while (pos < len) {
+#ifdef KS_UTF8_SSE2
+        if (pos + 16 <= len) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(s + pos));
+            if (_mm_movemask_epi8(v) == 0) {
+                pos += 16;
+                continue;
+            }
+        }
+#else
+        if (pos + 8 <= len) {
+            std::uint64_t word;
+            std::memcpy(&word, s + pos, 8);
+            if ((word & 0x8080808080808080ull) == 0) {
+                pos += 8;
+                continue;
+            }
+        }
+#endif
+        if (s[pos] < 0x80) {
+            ++pos;
+            continue;
+        }
+        std::size_t n = sequence_length(s, len, pos);
+        if (n == 0) return pos;
+        pos += n;
+    }
+    return len;
+}
+
+auto scalar_validate(const char* data, std::size_t len) -> bool {
+    return scalar_error_offset((const unsigned char*)data, len, 0) == len;
+}
+
+// ==================== AVX2 实现（Keiser–Lemire 查表校验） ====================
+
+#ifdef KS_UTF8_AVX2
+
+// 错误类别，每个位对应一类非法的 (前一字节, 当前字节) 组合
+constexpr unsigned char TOO_SHORT = 1 << 0;      // 首字节后没有续字节
+constexpr unsigned char TOO_LONG = 1 << 1;       // ASCII 后出现续字节
+constexpr unsigned char OVERLONG_3 = 1 << 2;     // 11100000 100_____
+constexpr unsigned char TOO_LARGE = 1 << 3;      // 大于 U+10FFFF
+constexpr unsigned char SURROGATE = 1 << 4;      // 11101101 101_____
+constexpr unsigned char OVERLONG_2 = 1 << 5;     // 1100000_ 10______
+constexpr unsigned char TOO_LARGE_1000 = 1 << 6;
+constexpr unsigned char OVERLONG_4 = 1 << 6;     // 11110000 1000____
+constexpr unsigned char TWO_CONTS = 1 << 7;      // 两个续字节相邻（需要结合前 2、3 个字节判断）
+constexpr unsigned char CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+#define KS_UTF8_TABLE(...) _mm256_setr_epi8(__VA_ARGS__, __VA_ARGS__)
+
+KS_TARGET_AVX2 inline auto lookup16(__m256i index, __m256i table) -> __m256i {
+    return _mm256_shuffle_epi8(table, index);
+}
+
+KS_TARGET_AVX2 inline auto high_nibble(__m256i v) -> __m256i {
+    return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+}
+
+/// 当前块整体右移 N 字节，空出的位置用上一块末尾的字节填充
+template<int N>
+KS_TARGET_AVX2 inline auto prev_bytes(__m256i input, __m256i prev_input) -> __m256i {
+    return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input, input, 0x21), 16 - N);
+}
+
+KS_TARGET_AVX2 auto avx2_check_block(__m256i input, __m256i prev_input) -> __m256i {
+    const __m256i byte_1_high_table = KS_UTF8_TABLE(
+        (char)TOO_LONG, (char)TOO_LONG, (char)TOO_LONG, (char)TOO_LONG,
+        (char)TOO_LONG, (char)TOO_LONG, (char)TOO_LONG, (char)TOO_LONG,
+        (char)TWO_CONTS, (char)TWO_CONTS, (char)TWO_CONTS, (char)TWO_CONTS,
+        (char)(TOO_SHORT | OVERLONG_2),
+        (char)TOO_SHORT,
+        (char)(TOO_SHORT | OVERLONG_3 | SURROGATE),
+        (char)(TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4));
+    const __m256i byte_1_low_table = KS_UTF8_TABLE(
+        (char)(CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4),
+        (char)(CARRY | OVERLONG_2),
+        (char)CARRY,
+        (char)CARRY,
+        (char)(CARRY | TOO_LARGE),
+        (char)(CARRY | TOO_LARGE | TOO_LARGE_1000),
+        (char)(CARRY | TOO_LARGE | TOO_LARGE_1000),
+        (char)(CARRY | TOO_LARGE | TOO_LARGE_1000),
+        (char)(CARRY | TOO_LARGE | TOO_LARGE_1000),
+        (char)(CARRY | TOO_LARGE | TOO_LARGE_1000),
+        (char)(CARRY | TOO_LARGE | TOO_LARGE_1000),
+        (char)(CARRY | TOO_LARGE | TOO_LARGE_1000),
+        (char)(CARRY | TOO_LARGE | TOO_LARGE_1000),
+        (char)(CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE),
+        (char)(CARRY | TOO_LARGE | TOO_LARGE_1000),
+        (char)(CARRY | TOO_LARGE | TOO_LARGE_1000));
+    const __m256i byte_2_high_table = KS_UTF8_TABLE(
+        (char)TOO_SHORT, (char)TOO_SHORT, (char)TOO_SHORT, (char)TOO_SHORT,
+        (char)TOO_SHORT, (char)TOO_SHORT, (char)TOO_SHORT, (char)TOO_SHORT,
+        (char)(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4),
+        (char)(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE),
+        (char)(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+        (char)(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+        (char)TOO_SHORT, (char)TOO_SHORT, (char)TOO_SHORT, (char)TOO_SHORT);
+
+    // 按 (前一字节高 4 位, 前一字节低 4 位, 当前字节高 4 位) 查三张表，三者的交集即错误类别
+    __m256i prev1 = prev_bytes<1>(input, prev_input);
+    __m256i special = _mm256_and_si256(
+        _mm256_and_si256(lookup16(high_nibble(prev1), byte_1_high_table),
+                         lookup16(_mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)), byte_1_low_table)),
+        lookup16(high_nibble(input), byte_2_high_table));
+
+    // 三、四字节序列的第 3、4 个字节必须是续字节：此时 TWO_CONTS 是合法的，用异或抵消
+    __m256i prev2 = prev_bytes<2>(input, prev_input);
+    __m256i prev3 = prev_bytes<3>(input, prev_input);
+    __m256i is_third = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+    __m256i is_fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+    __m256i must23 = _mm256_and_si256(_mm256_or_si256(is_third, is_fourth), _mm256_set1_epi8((char)0x80));
+    return _mm256_xor_si256(must23, special);
+}
+
+/// 块末尾是否有尚未结束的多字节序列
+KS_TARGET_AVX2 inline auto avx2_incomplete(__m256i input) -> __m256i {
+    const __m256i max_value = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+    return _mm256_subs_epu8(input, max_value);
+}
+
+/// 校验一块输入，累积错误位并更新跨块状态
+KS_TARGET_AVX2 inline auto avx2_process(__m256i input, __m256i& prev_input, __m256i& prev_incomplete, __m256i& error)
+    -> void {
+    if (_mm256_movemask_epi8(input) == 0) {
+        // 纯 ASCII 块：只需确认上一块没有未结束的序列
+        error = _mm256_or_si256(error, prev_incomplete);
+    } else {
+        error = _mm256_or_si256(error, avx2_check_block(input, prev_input));
+        prev_incomplete = avx2_incomplete(input);
+    }
+    prev_input = input;
+}
+
+KS_TARGET_AVX2 auto avx2_validate(const char* data, std::size_t len) -> bool {
+    __m256i error = _mm256_setzero_si256();
+    __m256i prev_input = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+    std::size_t pos = 0;
+    for (; pos + 32 <= len; pos += 32) {
+        avx2_process(_mm256_loadu_si256((const __m256i*)(data + pos)), prev_input, prev_incomplete, error);
+    }
+    if (pos < len) {
+        // 尾部补 0（ASCII）凑成一整块，未结束的序列会被判为 TOO_SHORT
+        alignas(32) char tail[32] = {};
+        std::memcpy(tail, data + pos, len - pos);
+        avx2_process(_mm256_load_si256((const __m256i*)tail), prev_input, prev_incomplete, error);
+    }
+    error = _mm256_or_si256(error, prev_incomplete);
+    return _mm256_testz_si256(error, error) != 0;
+}
+
+#undef KS_UTF8_TABLE
+
+#endif // KS_UTF8_AVX2
+
+// ==================== 运行时分派 ====================
+
+using ValidateKernel = bool (*)(const char*, std::size_t);
+
+auto select_validate() -> ValidateKernel {
+#ifdef KS_UTF8_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return avx2_validate;
+#endif
+    return scalar_validate;
+}
+
+/// 短于一个向量块的输入直接走标量路径
+constexpr std::size_t SIMD_MIN_LEN = 32;
+
+} // namespace
+
+auto utf8_validate(const char* data, std::size_t len) -> bool {
+    if (len < SIMD_MIN_LEN) return scalar_validate(data, len);
+    static const ValidateKernel kernel = select_validate();
+    return kernel(data, len);
+}
+
+auto utf8_error_offset(const char* data, std::size_t len) -> std::size_t {
+    return scalar_error_offset((const unsigned char*)data, len, 0);
+}
+
+auto utf8_count(const char* data, std::size_t len) -> std::size_t {
+    std::size_t continuation = 0;
+    std::size_t i = 0;
+#ifdef KS_UTF8_SSE2
+    // 续字节 10xxxxxx 作为有符号数都小于 -64
+    const __m128i limit = _mm_set1_epi8(-64);
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+        continuation += (std::size_t)popcount((unsigned)_mm_movemask_epi8(_mm_cmplt_epi8(v, limit)));
+    }
+#endif
+    for (; i < len; ++i) {
+        continuation += ((unsigned char)data[i] & 0xC0) == 0x80;
+    }
+    return len - continuation;
+}
+
+auto utf8_decode(const char* data, std::size_t len, std::size_t& pos) -> char32_t {
+    auto* s = (const unsigned char*)data;
+    unsigned char c = s[pos];
+    if (c < 0x80) {
+        ++pos;
+        return c;
+    }
+    std::size_t n = sequence_length(s, len, pos);
+    if (n == 0) {
+        ++pos;
+        return REPLACEMENT_CHAR;
+    }
+    char32_t cp = c & (0x7F >> n);
+    for (std::size_t i = 1; i < n; ++i) {
+        cp = (cp << 6) | (s[pos + i] & 0x3F);
+    }
+    pos += n;
+    return cp;
+}
+
+auto utf8_encode(char32_t cp, char* out) -> std::size_t {
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
+    }
+    if ((cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF) cp = REPLACEMENT_CHAR;
+    std::size_t n;
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        n = 2;
+    } else if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        n = 3;
+    } else {
+        out[0] = (char)(0xF0 | (cp >> 18));
+        n = 4;
+    }
+    for (std::size_t i = 1; i < n; ++i) {
+        out[i] = (char)(0x80 | ((cp >> (6 * (n - 1 - i))) & 0x3F));
+    }
+    return n;
+}
+
+auto utf8_append(String& out, char32_t cp) -> void {
+    if (cp < 0x80) {
+        out.push_back((char)cp);
+        return;
+    }
+    char buf[4];
+    out.append(buf, utf8_encode(cp, buf));
+}
+
+} // namespace detail
+
+// ==================== Utf8Index ====================
+
+Utf8Index::Utf8Index(StringView text)
+    : data_(text.data()), len_(text.len()), count_(detail::utf8_count(text.data(), text.len())) {
+    if (count_ == len_) return;  // 纯 ASCII
+    samples_.reserve(count_ / STRIDE + 1);
+    SizeType index = 0;
+    for (SizeType pos = 0; pos < len_; ++pos) {
+        if (((unsigned char)data_[pos] & 0xC0) == 0x80) continue;
+        if (index % STRIDE == 0) samples_.push_back(pos);
+        ++index;
+    }
+}
+
+auto Utf8Index::byte_offset(SizeType index) const -> SizeType {
+    if (index >= count_) return len_;
+    if (samples_.empty()) return index;
+    SizeType pos = samples_[index / STRIDE];
+    for (SizeType r = index % STRIDE; r > 0; --r) {
+        ++pos;
+        while (pos < len_ && ((unsigned char)data_[pos] & 0xC0) == 0x80) ++pos;
+    }
+    return pos;
+}
+
+auto Utf8Index::char_at(SizeType index) const -> char32_t {
+    SizeType pos = byte_offset(index);
+    if (pos >= len_) return 0;
+    return detail::utf8_decode(data_, len_, pos);
+}
+
+auto Utf8Index::substr(SizeType start, SizeType count) const -> StringView {
+    SizeType from = byte_offset(start);
+    SizeType to = count >= count_ - std::min(start, count_) ? len_ : byte_offset(start + count);
+    return StringView(data_ + from, to - from);
+}
+
+// ==================== String / StringView 的 UTF-8 方法 ====================
+
+namespace {
+
+auto invalid_utf8(const char* data, std::size_t len) -> String {
+    return String("invalid utf-8 at byte ") + String::from_uint(detail::utf8_error_offset(data, len));
+}
+
+} // namespace
+
+auto String::is_utf8() const -> bool {
+    return detail::utf8_validate(data(), len());
+}
+
+auto String::char_len() const -> SizeType {
+    return detail::utf8_count(data(), len());
+}
+
+auto String::chars() const -> CharRange {
+    return CharRange(data(), len());
+}
+
+auto StringView::chars() const -> CharRange {
+    return CharRange(data(), len());
+}
+
+auto String::to_utf16() const -> Result<std::u16string, String> {
+    if (!detail::utf8_validate(data(), len())) {
+        return err<std::u16string>(invalid_utf8(data(), len()));
+    }
+    std::u16string result;
+    result.reserve(len());
+    const char* s = data();
+    SizeType n = len();
+    for (SizeType pos = 0; pos < n; ) {
+        char32_t cp = detail::utf8_decode(s, n, pos);
+        if (cp >= 0x10000) {
+            cp -= 0x10000;
+            result.push_back((char16_t)(0xD800 + (cp >> 10)));
+            result.push_back((char16_t)(0xDC00 + (cp & 0x3FF)));
+        } else {
+            result.push_back((char16_t)cp);
+        }
+    }
+    return ok(std::move(result));
+}
+
+auto String::to_utf32() const -> Result<std::u32string, String> {
+    if (!detail::utf8_validate(data(), len())) {
+        return err<std::u32string>(invalid_utf8(data(), len()));
+    }
+    std::u32string result;
+    result.reserve(char_len());
+    const char* s = data();
+    SizeType n = len();
+    for (SizeType pos = 0; pos < n; ) {
+        result.push_back(detail::utf8_decode(s, n, pos));
+    }
+    return ok(std::move(result));
+}
+
+auto String::from_utf16(std::u16string_view text) -> Result<String, String> {
+    String result;
+    result.reserve(text.size());
+    for (SizeType i = 0; i < text.size(); ++i) {
+        char32_t unit = text[i];
+        if (unit >= 0xD800 && unit <= 0xDBFF && i + 1 < text.size() && text[i + 1] >= 0xDC00 && text[i + 1] <= 0xDFFF) {
+            unit = 0x10000 + ((unit - 0xD800) << 10) + (text[i + 1] - 0xDC00);
+            ++i;
+        } else if (unit >= 0xD800 && unit <= 0xDFFF) {
+            return err<String>(String("unpaired surrogate at utf-16 unit ") + String::from_uint(i));
+        }
+        detail::utf8_append(result, unit);
+    }
+    return ok(std::move(result));
+}
+
+auto String::from_utf32(std::u32string_view text) -> Result<String, String> {
+    String result;
+    result.reserve(text.size());
+    for (SizeType i = 0; i < text.size(); ++i) {
+        char32_t cp = text[i];
+        if ((cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF) {
+            return err<String>(String("invalid code point at utf-32 unit ") + String::from_uint(i));
+        }
+        detail::utf8_append(result, cp);
+    }
+    return ok(std::move(result));
+}
+
+} // namespace ks
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "result.hpp"
+#include "string.hpp"
+#include "string_view.hpp"
+
+namespace ks {
+
+namespace detail {
+
+/// 非法字节解码时使用的替换字符 U+FFFD
+constexpr char32_t REPLACEMENT_CHAR = 0xFFFD;
+
+/// 校验 data[0, len) 是否为合法 UTF-8（拒绝过长编码、代理项和超过 U+10FFFF 的码点）。
+/// 支持 AVX2 时使用 Keiser–Lemire 查表算法按 32 字节一块校验，否则按 16 字节跳过 ASCII 后逐字节校验
+auto utf8_validate(const char* data, std::size_t len) -> bool;
+
+/// 第一个非法序列的起始字节位置，合法时返回 len
+auto utf8_error_offset(const char* data, std::size_t len) -> std::size_t;
+
+/// 码点个数：统计非续字节（10xxxxxx 以外）的个数，输入需为合法 UTF-8
+auto utf8_count(const char* data, std::size_t len) -> std::size_t;
+
+/// 解码 data[pos] 开始的一个码点，返回码点并把 pos 移到下一个码点。
+/// 遇到非法序列时返回 U+FFFD 并只前进一个字节
+auto utf8_decode(const char* data, std::size_t len, std::size_t& pos) -> char32_t;
+
+/// 把码点编码写入 out（至少 4 字节），返回写入的字节数；码点非法（代理项或超出范围）时写入 U+FFFD
+auto utf8_encode(char32_t cp, char* out) -> std::size_t;
+
+/// 把码点编码追加到 out，码点非法（代理项或超出范围）时追加 U+FFFD
+auto utf8_append(String& out, char32_t cp) -> void;
+
+} // namespace detail
+
+/// 逐个码点遍历 UTF-8 文本的区间，元素类型为 char32_t，非法字节视为 U+FFFD。
+/// 只保存视图，遍历期间被引用的字符串必须保持有效
+class CharRange {
+    const char* data_;
+    std::size_t len_;
+
+public:
+    using SizeType = std::size_t;
+
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = char32_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const char32_t*;
+        using reference = char32_t;
+
+        Iterator() : data_(nullptr), len_(0), pos_(0), next_(0), current_(0) {}
+        Iterator(const char* data, SizeType len, SizeType pos) : data_(data), len_(len), pos_(pos), next_(pos), current_(0) {
+            load();
+        }
+
+        auto operator*() const -> char32_t { return current_; }
+
+        /// 当前码点在原文本中的字节位置
+        auto offset() const -> SizeType { return pos_; }
+
+        auto operator++() -> Iterator& {
+            pos_ = next_;
+            load();
+            return *this;
+        }
+
+        auto operator++(int) -> Iterator {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend auto operator==(const Iterator& a, const Iterator& b) -> bool { return a.pos_ == b.pos_; }
+        friend auto operator!=(const Iterator& a, const Iterator& b) -> bool { return a.pos_ != b.pos_; }
+
+    private:
+        const char* data_;
+        SizeType len_;
+        SizeType pos_;
+        SizeType next_;
+        char32_t current_;
+
+        auto load() -> void {
+            if (pos_ < len_) current_ = detail::utf8_decode(data_, len_, next_);
+        }
+    };
+
+    CharRange(const char* data, SizeType len) : data_(data), len_(len) {}
+
+    auto begin() const -> Iterator { return Iterator(data_, len_, 0); }
+    auto end() const -> Iterator { return Iterator(data_, len_, len_); }
+};
+
+/// 码点下标到字节位置的索引：每 STRIDE 个码点记录一次字节位置，
+/// 按码点下标访问时从最近的记录点向后最多扫描 STRIDE - 1 个码点，摊还 O(1)。
+/// 纯 ASCII 文本不建表，码点下标即字节位置。文本需为合法 UTF-8；只保存视图，文本修改后需重新构建
+class Utf8Index {
+    const char* data_;
+    std::size_t len_;
+    std::size_t count_;
+    std::vector<std::size_t> samples_;  // samples_[k] = 第 k * STRIDE 个码点的字节位置
+
+public:
+    using SizeType = std::size_t;
+
+    static constexpr SizeType STRIDE = 32;
+
+    explicit Utf8Index(StringView text);
+
+    /// 码点个数
+    auto char_count() const -> SizeType { return count_; }
+
+    /// 第 index 个码点的字节位置，index == char_count() 时返回字节长度
+    auto byte_offset(SizeType index) const -> SizeType;
+
+    /// 第 index 个码点
+    auto char_at(SizeType index) const -> char32_t;
+
+    /// 码点区间 [start, start + count) 对应的子串
+    auto substr(SizeType start, SizeType count) const -> StringView;
+};
+
+} // namespace ks
@@ -1,15 +1,30 @@
 #include <gtest/gtest.h>
 #include "src/result.hpp"
 #include "src/string.hpp"
+#include "src/string_view.hpp"
+#include "src/string_builder.hpp"
+#include "src/rope.hpp"
+#include "src/utf8.hpp"
+#include "src/charconv.hpp"
+#include "src/search.hpp"
+#include "src/multi_search.hpp"
+#include "src/atom.hpp"
 #include "src/list.hpp"
 #include "src/dict.hpp"
+#include "src/frozen_dict.hpp"
+#include "src/mapped_dict.hpp"
 #include "src/print.hpp"
+#include "src/sink.hpp"
+#include "src/logger.hpp"
 #include "src/color.hpp"
 #include "src/bigint.hpp"
 #include "src/decimal.hpp"
+#include <fstream>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <vector>
+#include <thread>
 
 using namespace ks;
 
@@ -77,6 +92,40 @@ TEST(StringTest, Construction) {
     EXPECT_EQ(s4, String("aaa"));
 }
 
+TEST(StringTest, InlineStorage) {
+    EXPECT_EQ(sizeof(String), 24u);
+
+    String s(23, 'x');
+    EXPECT_TRUE(s.is_inline());
+    EXPECT_EQ(s.len(), 23u);
+    EXPECT_EQ(s.c_str()[23], '\0');
+
+    // 跨过 23 字节边界后转入堆，内容保持不变
+    s.push_back('y');
+    EXPECT_FALSE(s.is_inline());
+    EXPECT_EQ(s, String(23, 'x') + "y");
+    s.erase(0, 10);
+    s.shrink_to_fit();
+    EXPECT_TRUE(s.is_inline());
+    EXPECT_EQ(s, String(13, 'x') + "y");
+
+    String moved = std::move(s);
+    EXPECT_EQ(moved.len(), 14u);
+    EXPECT_TRUE(s.empty());
+
+    // 追加、插入自身
+    String t("abc");
+    t.append(t.c_str() + 1, 2);
+    EXPECT_EQ(t, String("abcbc"));
+    for (int i = 0; i < 3; ++i) t.append(t);
+    EXPECT_EQ(t.len(), 40u);
+    t.insert(2, t);
+    EXPECT_EQ(t.len(), 80u);
+    EXPECT_EQ(t.substr(0, 7), String("ababcbc"));
+    t.resize(4);
+    EXPECT_EQ(t, String("abab"));
+}
+
 TEST(StringTest, Find) {
     String s("hello world");
     EXPECT_EQ(s.find("world"), 6);
@@ -132,12 +181,66 @@ TEST(StringTest, LowerUpper) {
     EXPECT_EQ(s.swapcase(), String("hELLO wORLD"));
 }
 
+TEST(StringTest, CharClassLong) {
+    // 超过一个向量块的输入，覆盖 SIMD 主循环、尾部以及含非 ASCII 字节的块
+    String letters(std::string(70, 'a') + "Z");
+    EXPECT_TRUE(letters.isalpha());
+    EXPECT_TRUE(letters.isalnum());
+    EXPECT_FALSE(letters.islower());
+    EXPECT_FALSE(letters.isupper());
+    EXPECT_TRUE(String(std::string(40, '7')).isdigit());
+    EXPECT_FALSE(String(std::string(40, '7') + "x").isdigit());
+    EXPECT_TRUE(String(std::string(33, ' ') + "\t\n\r\v\f").isspace());
+    EXPECT_TRUE(String(std::string(50, 'q') + "\xC3\xA9" + "1").islower());
+
+    String mixed(std::string(20, 'a') + "\xC3\xA9 Hello, World! [ok] @" + std::string(20, 'B'));
+    EXPECT_EQ(mixed.upper(), String(std::string(20, 'A') + "\xC3\x89 HELLO, WORLD! [OK] @" + std::string(20, 'B')));
+    EXPECT_EQ(mixed.lower(), String(std::string(20, 'a') + "\xC3\xA9 hello, world! [ok] @" + std::string(20, 'b')));
+    EXPECT_EQ(mixed.swapcase(), String(std::string(20, 'A') + "\xC3\x89 hELLO, wORLD! [OK] @" + std::string(20, 'b')));
+}
+
+TEST(StringTest, UnicodeCase) {
+    EXPECT_EQ(String("straße İstanbul").upper(), String("STRASSE İSTANBUL"));
+    EXPECT_EQ(String("ΑΒΓ Δ").lower(), String("αβγ δ"));
+    // 词尾的 Σ 转为 ς
+    EXPECT_EQ(String("ΟΔΥΣΣΕΥΣ").lower(), String("οδυσσευς"));
+    EXPECT_EQ(String("ǆemal ﬁsh").title(), String("ǅemal Fish"));
+    EXPECT_EQ(String("ǆEMAL").capitalize(), String("ǅemal"));
+    EXPECT_EQ(String("Élan ÉLAN").swapcase(), String("éLAN élan"));
+
+    EXPECT_TRUE(String("Über Élan").istitle());
+    EXPECT_FALSE(String("ÜBER").istitle());
+    EXPECT_FALSE(String("").istitle());
+    EXPECT_TRUE(String("ǅemal").istitle());
+    EXPECT_TRUE(String("привет").islower());
+    EXPECT_TRUE(String("ПРИВЕТ 123").isupper());
+    EXPECT_TRUE(String("日本語abc").isalpha());
+    EXPECT_TRUE(String("١٢٣").isdigit());
+    EXPECT_TRUE(String("\u00A0\u3000 ").isspace());
+    EXPECT_FALSE(String("abc\xFF").isalpha());
+
+    // 不是合法 UTF-8 的字节原样保留
+    String text(std::string(40, 'x') + "\xE9");
+    EXPECT_EQ(text.upper(), String(std::string(40, 'X') + "\xE9"));
+}
+
 TEST(StringTest, Strip) {
     String s("  hello  ");
     EXPECT_EQ(s.strip(), String("hello"));
     EXPECT_EQ(s.lstrip(), String("hello  "));
     EXPECT_EQ(s.rstrip(), String("  hello"));
     EXPECT_EQ(s.strip(" h"), String("ello"));
+    EXPECT_EQ(String("xxhixyx").strip("xy"), String("hi"));
+    EXPECT_EQ(String("abc").strip(""), String("abc"));
+
+    String t("\t  hello \n");
+    t.strip_inplace();
+    EXPECT_EQ(t, String("hello"));
+    String u("--a-b--");
+    EXPECT_EQ(u.lstrip_inplace("-"), String("a-b--"));
+    EXPECT_EQ(u.rstrip_inplace("-"), String("a-b"));
+    String all("   ");
+    EXPECT_TRUE(all.strip_inplace().empty());
 }
 
 TEST(StringTest, Split) {
@@ -149,9 +252,22 @@ TEST(StringTest, Split) {
     EXPECT_EQ(parts[2], String("c"));
 
     auto parts2 = s.rsplit(",", 1);
-    // rsplit with maxsplit not implemented, but we have rsplit without maxsplit
+    ASSERT_EQ(parts2.size(), 2);
+    EXPECT_EQ(parts2[0], String("a,b"));
+    EXPECT_EQ(parts2[1], String("c"));
     auto parts3 = s.rsplit(",");
     EXPECT_EQ(parts3.size(), 3);
+    EXPECT_EQ(parts3[0], String("a"));
+
+    auto head = s.split(",", 1);
+    ASSERT_EQ(head.size(), 2);
+    EXPECT_EQ(head[1], String("b,c"));
+    EXPECT_EQ(s.split(",", 0).size(), 1);
+
+    auto words = String("  one two  three ").rsplit(1);
+    ASSERT_EQ(words.size(), 2);
+    EXPECT_EQ(words[0], String("  one two"));
+    EXPECT_EQ(words[1], String("three"));
 }
 
 TEST(StringTest, Join) {
@@ -165,6 +281,14 @@ TEST(StringTest, Replace) {
     EXPECT_EQ(s.replace("world", "there"), String("hello there"));
 }
 
+TEST(StringTest, Format) {
+    EXPECT_EQ(String("{:>5}|{:.3f}|{{}}").format("ab", 0.5).value(), String("   ab|0.500|{}"));
+    EXPECT_EQ(String("{} {}").format(std::vector<String>{"a", "b"}).value(), String("a b"));
+    EXPECT_EQ(String("{} {}").format(1).error(), String("not enough arguments for format"));
+    EXPECT_EQ(String("{:x}").format("text").error(), String("format spec does not apply to the argument"));
+    EXPECT_EQ(String("{:?}").format(1).error(), String("invalid format spec"));
+}
+
 TEST(StringTest, ToInt) {
     String s1("123");
     auto r = s1.to_int();
@@ -179,6 +303,10 @@ TEST(StringTest, ToInt) {
     String s3("12.3");
     auto r3 = s3.to_int();
     EXPECT_TRUE(r3.is_err());
+
+    EXPECT_EQ(String(" 42\n").to_int().value(), 42);
+    EXPECT_EQ(String("9223372036854775808").to_int().error(), String("integer out of range"));
+    EXPECT_EQ(String("").to_int().error(), String("invalid integer format"));
 }
 
 TEST(StringTest, ToFloat) {
@@ -186,6 +314,489 @@ TEST(StringTest, ToFloat) {
     auto r = s1.to_float();
     EXPECT_TRUE(r.is_ok());
     EXPECT_DOUBLE_EQ(r.value(), 3.14);
+
+    EXPECT_EQ(String("1e400").to_float().error(), String("float out of range"));
+    EXPECT_TRUE(String("1.5x").to_float().is_err());
+    EXPECT_EQ(StringView(" -2.5 ").to_float().value(), -2.5);
+}
+
+// ========== StringView 测试 ==========
+TEST(StringViewTest, Basic) {
+    String s("hello world");
+    StringView v(s);
+    EXPECT_EQ(v.len(), 11);
+    EXPECT_EQ(v.data(), s.c_str());
+    EXPECT_EQ(v.find("world"), 6);
+    EXPECT_EQ(v.rfind("o"), 7);
+    EXPECT_EQ(v.count("o"), 2);
+    EXPECT_TRUE(v.startswith("hello"));
+    EXPECT_TRUE(v.endswith("world"));
+    EXPECT_EQ(v.substr(6), StringView("world"));
+    EXPECT_EQ(v.substr(0, 5).to_string(), String("hello"));
+    EXPECT_TRUE(StringView("123").isdigit());
+}
+
+TEST(StringViewTest, Strip) {
+    String s("  hello  ");
+    StringView v(s);
+    EXPECT_EQ(v.strip(), StringView("hello"));
+    EXPECT_EQ(v.lstrip(), StringView("hello  "));
+    EXPECT_EQ(v.rstrip(), StringView("  hello"));
+    EXPECT_EQ(v.strip(" h"), StringView("ello"));
+    EXPECT_EQ(v.strip().data(), s.c_str() + 2);
+}
+
+TEST(StringViewTest, Split) {
+    String s("a,b,,c");
+    auto parts = StringView(s).split(",");
+    ASSERT_EQ(parts.size(), 4);
+    EXPECT_EQ(parts[0], StringView("a"));
+    EXPECT_EQ(parts[2], StringView(""));
+    EXPECT_EQ(parts[3].data(), s.c_str() + 5);
+
+    auto words = StringView("  one two\tthree ").split();
+    ASSERT_EQ(words.size(), 3);
+    EXPECT_EQ(words[2], StringView("three"));
+
+    auto lines = StringView("l1\r\nl2\nl3").splitlines();
+    ASSERT_EQ(lines.size(), 3);
+    EXPECT_EQ(lines[1], StringView("l2"));
+
+    auto p = StringView("key=value=x").partition("=");
+    EXPECT_EQ(p[0], StringView("key"));
+    EXPECT_EQ(p[2], StringView("value=x"));
+    auto rp = StringView("key=value=x").rpartition("=");
+    EXPECT_EQ(rp[0], StringView("key=value"));
+    EXPECT_EQ(rp[2], StringView("x"));
+}
+
+TEST(StringViewTest, SplitIter) {
+    String s("a,b,,c");
+    std::vector<String> fields;
+    for (auto field : s.split_iter(",")) {
+        fields.push_back(field.to_string());
+    }
+    ASSERT_EQ(fields.size(), 4);
+    EXPECT_EQ(fields[2], String(""));
+    EXPECT_EQ(fields[3], String("c"));
+
+    // 只取第一个字段
+    auto first = *s.split_iter(",").begin();
+    EXPECT_EQ(first.data(), s.c_str());
+    EXPECT_EQ(first, StringView("a"));
+
+    auto limited = StringView("a,b,c").split_iter(",", 1).to_vector();
+    ASSERT_EQ(limited.size(), 2);
+    EXPECT_EQ(limited[1], StringView("b,c"));
+
+    auto right = StringView("a,b,c").rsplit_iter(",", 1).to_vector();
+    ASSERT_EQ(right.size(), 2);
+    EXPECT_EQ(right[0], StringView("c"));
+    EXPECT_EQ(right[1], StringView("a,b"));
+
+    auto words = StringView("  one two  three ").split_iter(1).to_vector();
+    ASSERT_EQ(words.size(), 2);
+    EXPECT_EQ(words[1], StringView("two  three "));
+    EXPECT_EQ(StringView("   ").split_iter().to_vector().size(), 0);
+    EXPECT_EQ(StringView("").split_iter(",").to_vector().size(), 1);
+
+    // 短分隔符被复制，临时 String 作分隔符、区间销毁后继续使用迭代器都安全
+    String pairs("k1::v1::k2::v2");
+    std::vector<String> parts;
+    for (auto field : pairs.split_iter(String("::"))) parts.push_back(field.to_string());
+    ASSERT_EQ(parts.size(), 4);
+    EXPECT_EQ(parts[3], String("v2"));
+    auto it = pairs.rsplit_iter(String("::")).begin();
+    ++it;
+    EXPECT_EQ(*it, StringView("k2"));
+    String long_sep("--------boundary--------");
+    String body = String("a") + long_sep + String("b");
+    auto sections = body.split_iter(long_sep).to_vector();
+    ASSERT_EQ(sections.size(), 2);
+    EXPECT_EQ(sections[1], StringView("b"));
+
+    String text("l1\r\nl2\n");
+    auto lines = text.splitlines_iter(true).to_vector();
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines[0], StringView("l1\r\n"));
+}
+
+// ========== StringBuilder 测试 ==========
+TEST(StringBuilderTest, Append) {
+    StringBuilder sb;
+    sb.append("x=").append_int(-42).append(", ").append_uint(18446744073709551615ull);
+    sb.append(' ').append_float(2.5, 2).append(3, '!');
+    EXPECT_EQ(sb.view(), "x=-42, 18446744073709551615 2.50!!!");
+    StringBuilder min;
+    min.append_int(INT64_MIN);
+    EXPECT_EQ(min.view(), "-9223372036854775808");
+
+    StringBuilder fmt;
+    fmt.append_fmt("{} + {} = {} {{ok}}", 1, String("two"), 3.0);
+    EXPECT_EQ(fmt.view(), "1 + two = 3.0 {ok}");
+
+    // finish 移交缓冲区，之后构建器为空
+    StringBuilder big;
+    for (int i = 0; i < 100; ++i) big.append_int(i);
+    const char* buffer = big.view().data();
+    String result = big.finish();
+    EXPECT_EQ(result.c_str(), buffer);
+    EXPECT_TRUE(big.empty());
+}
+
+TEST(StringBuilderTest, Padding) {
+    String s("abc");
+    EXPECT_EQ(s.center(8, '*'), String("**abc***"));
+    EXPECT_EQ(s.ljust(5), String("abc  "));
+    EXPECT_EQ(s.rjust(5, '.'), String("..abc"));
+    EXPECT_EQ(s.rjust(2), String("abc"));
+    EXPECT_EQ(String("-42").zfill(6), String("-00042"));
+    EXPECT_EQ(String("42").zfill(40).len(), 40u);
+}
+
+// ========== Rope 测试 ==========
+TEST(RopeTest, Edit) {
+    Rope rope(String("hello world"));
+    rope.insert(5, ",").append("!");
+    EXPECT_EQ(rope.to_string(), String("hello, world!"));
+    rope.erase(0, 7);
+    EXPECT_EQ(rope.to_string(), String("world!"));
+    EXPECT_EQ(rope[0], 'w');
+    EXPECT_EQ(rope.substr(1, 3).to_string(), String("orl"));
+
+    // 多个叶子上的编辑与快照
+    String text;
+    for (int i = 0; i < 1000; ++i) text.append("0123456789");
+    Rope big(text);
+    Rope snapshot = big;
+    big.insert(5000, "XYZ").erase(0, 10);
+    EXPECT_EQ(big.len(), 10000u - 10 + 3);
+    EXPECT_EQ(big.to_string(4990, 3), String("XYZ"));
+    EXPECT_EQ(snapshot.to_string(), text);
+    EXPECT_LE(big.depth(), 8u);
+}
+
+TEST(RopeTest, LinesAndFind) {
+    String text;
+    for (int i = 0; i < 500; ++i) text.append(String("line ") + String(std::to_string(i)) + "\n");
+    Rope rope(text);
+    EXPECT_EQ(rope.line_count(), 501u);
+    EXPECT_EQ(rope.line(123), String("line 123"));
+    EXPECT_EQ(rope.line_of(rope.line_start(321) + 2), 321u);
+    EXPECT_EQ(rope.line(500), String(""));
+
+    // 跨越叶子边界的匹配
+    EXPECT_EQ(rope.find("line 499"), text.find("line 499"));
+    EXPECT_EQ(rope.rfind("line 1"), text.rfind("line 1"));
+    EXPECT_EQ(rope.count("\n"), 500u);
+    EXPECT_EQ(rope.find("absent"), -1);
+    for (std::size_t pos = Rope::MAX_LEAF - 7; pos < Rope::MAX_LEAF; ++pos) {
+        String needle = text.substr(pos, 8);
+        EXPECT_EQ(rope.find(needle, pos), text.substr(pos).find(needle) + (std::int64_t)pos);
+    }
+}
+
+// ========== UTF-8 测试 ==========
+
+TEST(Utf8Test, Validate) {
+    EXPECT_TRUE(String("hello, 世界 🌍").is_utf8());
+    EXPECT_FALSE(String("\xC0\xAF").is_utf8());          // 过长编码
+    EXPECT_FALSE(String("\xED\xA0\x80").is_utf8());      // 代理项
+    EXPECT_FALSE(String("\xF4\x90\x80\x80").is_utf8());  // 超过 U+10FFFF
+
+    // 超过一个向量块，非法字节分别落在块中间、块边界和末尾未结束的序列
+    String text;
+    for (int i = 0; i < 20; ++i) text += "abc é 中文 😀 ";
+    EXPECT_TRUE(text.is_utf8());
+    for (std::size_t pos : {7ul, 31ul, 32ul, 63ul, text.len() - 1}) {
+        String bad = text;
+        bad[pos] = (char)0xFF;
+        EXPECT_FALSE(bad.is_utf8()) << pos;
+    }
+    String truncated = text + "\xE4\xB8";
+    EXPECT_FALSE(truncated.is_utf8());
+
+    std::vector<std::uint8_t> bytes = {'a', 'b', 0xE4, 0xB8};
+    auto decoded = String::decode(bytes);
+    ASSERT_TRUE(decoded.is_err());
+    EXPECT_EQ(decoded.error(), "invalid utf-8 at byte 2");
+}
+
+TEST(Utf8Test, CharsAndTranscode) {
+    String s = "a中😀";
+    EXPECT_EQ(s.len(), 8u);
+    EXPECT_EQ(s.char_len(), 3u);
+
+    std::vector<char32_t> cps(s.chars().begin(), s.chars().end());
+    EXPECT_EQ(cps, (std::vector<char32_t>{U'a', U'中', U'😀'}));
+
+    EXPECT_EQ(s.to_utf16().unwrap(), u"a中😀");
+    EXPECT_EQ(s.to_utf32().unwrap(), U"a中😀");
+    EXPECT_EQ(String::from_utf16(u"a中😀").unwrap(), s);
+    EXPECT_EQ(String::from_utf32(U"a中😀").unwrap(), s);
+
+    EXPECT_TRUE(String("\xFF").to_utf16().is_err());
+    EXPECT_TRUE(String::from_utf16(std::u16string(1, (char16_t)0xD800)).is_err());
+}
+
+TEST(Utf8Test, Index) {
+    String text;
+    for (int i = 0; i < 100; ++i) text += i % 3 == 0 ? "中" : "x";
+    Utf8Index index(text);
+    EXPECT_EQ(index.char_count(), 100u);
+    for (std::size_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(index.char_at(i), i % 3 == 0 ? U'中' : U'x');
+    }
+    EXPECT_EQ(index.byte_offset(100), text.len());
+    EXPECT_EQ(index.substr(0, 4), "中xx中");
+    EXPECT_EQ(index.substr(98, 10), "x中");
+}
+
+// ========== 数值解析与格式化 测试 ==========
+TEST(CharconvTest, Int) {
+    std::int64_t v = 0;
+    std::string_view text = "-9223372036854775808,";
+    auto r = parse_int(text, v);
+    EXPECT_EQ(r.error, ParseError::None);
+    EXPECT_EQ(v, INT64_MIN);
+    EXPECT_EQ(*r.ptr, ',');
+
+    EXPECT_EQ(parse_int("9223372036854775808", v).error, ParseError::OutOfRange);
+    EXPECT_EQ(parse_int("-x", v).error, ParseError::Invalid);
+    EXPECT_EQ(v, INT64_MIN);  // 失败时不修改
+
+    std::uint64_t u = 0;
+    EXPECT_EQ(parse_uint("00000000000000000000018446744073709551615", u).error, ParseError::None);
+    EXPECT_EQ(u, UINT64_MAX);
+    EXPECT_EQ(parse_uint("18446744073709551616", u).error, ParseError::OutOfRange);
+    EXPECT_EQ(parse_uint("-1", u).error, ParseError::Invalid);
+    EXPECT_EQ(parse_uint("1234567890123456", u).error, ParseError::None);
+    EXPECT_EQ(u, 1234567890123456u);
+}
+
+TEST(CharconvTest, Float) {
+    double v = 0;
+    EXPECT_EQ(parse_float("0.1", v).error, ParseError::None);
+    EXPECT_EQ(v, 0.1);
+    parse_float("1.7976931348623157e308", v);
+    EXPECT_EQ(v, 1.7976931348623157e308);
+    parse_float("4.9406564584124654e-324", v);
+    EXPECT_EQ(v, 4.9406564584124654e-324);
+    parse_float("-.5E+1", v);
+    EXPECT_EQ(v, -5.0);
+    // 超过 19 位有效数字、恰好位于两个 double 正中间附近
+    parse_float("9007199254740993", v);
+    EXPECT_EQ(v, 9007199254740992.0);
+    parse_float("9007199254740993.0000000000000000001", v);
+    EXPECT_EQ(v, 9007199254740994.0);
+    parse_float("1.00000000000000011102230246251565404236316680908203125", v);
+    EXPECT_EQ(v, 1.0);
+
+    auto r = parse_float("2.5e", v);
+    EXPECT_EQ(v, 2.5);
+    EXPECT_EQ(*r.ptr, 'e');  // 不完整的指数不属于数值
+
+    parse_float("-Infinity", v);
+    EXPECT_EQ(v, -std::numeric_limits<double>::infinity());
+    EXPECT_EQ(parse_float("1e-400", v).error, ParseError::OutOfRange);
+    EXPECT_EQ(parse_float("0e-400", v).error, ParseError::None);
+    EXPECT_EQ(parse_float(".", v).error, ParseError::Invalid);
+    EXPECT_EQ(parse_float("0x10", v).error, ParseError::None);
+    EXPECT_EQ(v, 0.0);
+}
+
+TEST(CharconvTest, Column) {
+    auto ints = to_int_column(StringView("1\r\n-2\r\n 30 \r\n"));
+    ASSERT_TRUE(ints.is_ok());
+    EXPECT_EQ(ints.value(), (std::vector<std::int64_t>{1, -2, 30}));
+
+    auto floats = to_float_column(StringView("1.5,2,-3e2"), ',');
+    ASSERT_TRUE(floats.is_ok());
+    EXPECT_EQ(floats.value(), (std::vector<double>{1.5, 2.0, -300.0}));
+
+    auto bad = to_int_column(StringView("1\n2\nx\n"));
+    EXPECT_EQ(bad.error(), String("invalid integer at row 2"));
+    EXPECT_EQ(to_int_column(StringView("1\n\n2")).error(), String("invalid integer at row 1"));
+
+    String csv("a,1.25\nb,oops\n");
+    std::vector<StringView> column;
+    for (StringView line : StringView(csv).splitlines()) column.push_back(line.split(",")[1]);
+    EXPECT_EQ(to_float_column(column).error(), String("invalid float at row 1"));
+    column.pop_back();
+    EXPECT_EQ(to_float_column(column).value(), std::vector<double>{1.25});
+}
+
+TEST(CharconvTest, Format) {
+    char buffer[FLOAT_CHARS_MAX];
+    auto text = [&](char* end) { return std::string(buffer, end); };
+    EXPECT_EQ(text(format_int(INT64_MIN, buffer)), "-9223372036854775808");
+    EXPECT_EQ(text(format_uint(UINT64_MAX, buffer)), "18446744073709551615");
+    EXPECT_EQ(text(format_uint(0, buffer)), "0");
+
+    // 最短往返表示，格式与 Python 的 repr 相同
+    EXPECT_EQ(text(format_float(0.1, buffer)), "0.1");
+    EXPECT_EQ(text(format_float(0.1f, buffer)), "0.1");
+    EXPECT_EQ(text(format_float(3.0, buffer)), "3.0");
+    EXPECT_EQ(text(format_float(-0.0, buffer)), "-0.0");
+    EXPECT_EQ(text(format_float(1e16, buffer)), "1e+16");
+    EXPECT_EQ(text(format_float(1234567890123456.0, buffer)), "1234567890123456.0");
+    EXPECT_EQ(text(format_float(0.0001, buffer)), "0.0001");
+    EXPECT_EQ(text(format_float(1.5e-5, buffer)), "1.5e-05");
+    EXPECT_EQ(text(format_float(5e-324, buffer)), "5e-324");
+    EXPECT_EQ(text(format_float(-2.2250738585072014e-308, buffer)), "-2.2250738585072014e-308");
+    EXPECT_EQ(text(format_float(std::numeric_limits<double>::infinity(), buffer)), "inf");
+    EXPECT_EQ(text(format_float(std::numeric_limits<double>::quiet_NaN(), buffer)), "nan");
+
+    EXPECT_EQ(String::from_number(2.5), String("2.5"));
+    EXPECT_EQ(String::from_number((unsigned char)200), String("200"));
+    EXPECT_EQ(String("{} {}").format(1.25f, -7).value(), String("1.25 -7"));
+}
+
+// ========== Searcher 测试 ==========
+TEST(SearcherTest, Algorithms) {
+    String text(std::string(100, 'a') + "needle" + std::string(50, 'b') + "needle" + std::string(40, 'a'));
+    SearchAlgorithm algorithms[] = {SearchAlgorithm::Auto, SearchAlgorithm::Std,
+                                    SearchAlgorithm::FirstLast, SearchAlgorithm::Horspool};
+    for (auto algorithm : algorithms) {
+        Searcher searcher("needle", algorithm);
+        EXPECT_EQ(searcher.find(text), 100);
+        EXPECT_EQ(searcher.find(text, 101), 156);
+        EXPECT_EQ(searcher.rfind(text), 156);
+        EXPECT_EQ(searcher.count(text), 2);
+        EXPECT_EQ(searcher.find("need"), -1);
+        EXPECT_EQ(searcher.replace("a needle, a needle", "pin"), String("a pin, a pin"));
+    }
+    EXPECT_EQ(Searcher("x").algorithm(), SearchAlgorithm::FirstLast);
+    EXPECT_EQ(Searcher(StringView(text).substr(90, 40)).algorithm(), SearchAlgorithm::Horspool);
+    EXPECT_EQ(Searcher(StringView(text).substr(90, 40)).find(text), 90);
+
+    // 模式串被复制保存，临时 String 构造的查找器可以继续使用
+    String long_needle = String("x") * 40;
+    Searcher owned(long_needle + String("y"));
+    EXPECT_EQ(owned.needle().len(), 41);
+    EXPECT_EQ(owned.find(String("-") + long_needle + String("y")), 1);
+}
+
+TEST(SearcherTest, StringMethods) {
+    String s(std::string(64, '-') + "abc" + std::string(64, '-') + "abc");
+    EXPECT_EQ(s.find("abc"), 64);
+    EXPECT_EQ(s.rfind("abc"), 131);
+    EXPECT_EQ(s.count("abc"), 2);
+    EXPECT_EQ(s.count("--"), 64);
+    EXPECT_EQ(String("aaaa").count("aa"), 2);
+    EXPECT_EQ(String("abc").find(""), 0);
+    EXPECT_EQ(String("abc").count(""), 0);
+    EXPECT_EQ(s.replace("abc", "x").len(), 130);
+    EXPECT_EQ(String("key=value").count("="), 1);
+    EXPECT_EQ(String("a=b=c").replace("=", "=="), String("a==b==c"));
+    EXPECT_EQ(String("ab").replace("abc", "x"), String("ab"));
+
+    // 长模式串走 Horspool
+    String long_needle = String("0123456789") * 4;
+    String doc = long_needle + String("|") + long_needle + String("|");
+    EXPECT_EQ(doc.count(long_needle), 2);
+    EXPECT_EQ(StringView(doc).count(long_needle), 2);
+    EXPECT_EQ(doc.replace(long_needle, "#"), String("#|#|"));
+}
+
+TEST(SearcherTest, MultiPattern) {
+    MultiSearcher searcher(std::vector<String>{String("he"), String("she"), String("hers"), String("his")});
+    auto first = searcher.find_any("ushers");
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->start, 1);
+    EXPECT_EQ(first->end, 4);
+    EXPECT_EQ(searcher.pattern(first->pattern), String("she"));
+    EXPECT_FALSE(searcher.find_any("xyz").has_value());
+    EXPECT_EQ(searcher.count_all("he said his hers"), 3);
+
+    // 最左最长：起点相同时取更长的模式串，命中之间不重叠
+    MultiSearcher overlap(std::vector<String>{String("ab"), String("abcd"), String("bc"), String("c")});
+    EXPECT_EQ(overlap.replace_all("abcX abcd", {String("1"), String("2"), String("3"), String("4")}),
+              String("14X 2"));
+
+    Dict<String> secrets;
+    secrets.insert("alice", "[name]");
+    secrets.insert("555-1234", "[phone]");
+    String record("call alice at 555-1234, alice!");
+    EXPECT_EQ(record.replace_all(secrets), String("call [name] at [phone], [name]!"));
+    EXPECT_EQ(MultiSearcher(secrets).count_all(record), 3);
+
+    // 为确认没有更长的候选而向后读过的文本不再重新扫描，跨过的短命中也不会丢失
+    MultiSearcher prefix(std::vector<String>{String("abcd"), String("ab"), String("c")});
+    EXPECT_EQ(prefix.replace_all("abce abcd", {String("1"), String("2"), String("3")}), String("23e 1"));
+    String long_pattern = String("a") * 2000 + String("b");
+    MultiSearcher lookahead(std::vector<String>{String("a"), long_pattern});
+    String text = String("a") * 200000;
+    EXPECT_EQ(lookahead.count_all(text), 200000u);
+    text += String("b");
+    EXPECT_EQ(lookahead.count_all(text), 198000u + 1);
+}
+
+// ========== Atom 测试 ==========
+namespace {
+// 在本翻译单元的静态初始化期间构造，此时 atom.cpp 中的静态变量可能尚未初始化
+const Atom STATIC_EMPTY_ATOM;
+const std::size_t STATIC_EMPTY_LEN = STATIC_EMPTY_ATOM.str().len();
+} // namespace
+
+TEST(AtomTest, StaticInit) {
+    EXPECT_EQ(STATIC_EMPTY_LEN, 0u);
+    EXPECT_EQ(STATIC_EMPTY_ATOM, Atom());
+}
+
+TEST(AtomTest, Intern) {
+    Interner interner;
+    Atom a = interner.intern("identifier");
+    Atom b = interner.intern(String("identifier"));
+    Atom c = interner.intern("other");
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(a.str(), String("identifier"));
+    EXPECT_EQ(interner.size(), 2u);
+    EXPECT_TRUE(interner.lookup("other").has_value());
+    EXPECT_FALSE(interner.lookup("missing").has_value());
+    EXPECT_EQ(interner.intern(""), Atom());
+
+    // 扩容后旧的 Atom 仍然有效
+    for (int i = 0; i < 1000; ++i) interner.intern(String("name_") + String(std::to_string(i)));
+    EXPECT_EQ(interner.intern("identifier"), a);
+    EXPECT_EQ(interner.size(), 1002u);
+
+    EXPECT_EQ(Atom::intern("global"), Atom::intern("global"));
+}
+
+TEST(AtomTest, DictKey) {
+    Interner interner;
+    Atom key = interner.intern("count");
+    Dict<int> dict;
+    dict.insert(key, 1);
+    dict[key] += 1;
+    // 预先计算的哈希值与 String 键一致，两种键可以混用
+    EXPECT_EQ(dict.get(String("count"), 0), 2);
+    dict.insert("total", 5);
+    EXPECT_EQ(dict.get(interner.intern("total"), 0), 5);
+    EXPECT_EQ(dict.get(interner.intern("none"), -1), -1);
+    EXPECT_EQ(dict.size(), 2u);
+}
+
+TEST(AtomTest, Concurrent) {
+    Interner interner;
+    const int THREADS = 4;
+    const int NAMES = 2000;
+    std::vector<std::vector<Atom>> results(THREADS);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < NAMES; ++i) {
+                results[t].push_back(interner.intern(String("id") + String(std::to_string(i))));
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    EXPECT_EQ(interner.size(), (std::size_t)NAMES);
+    for (int t = 1; t < THREADS; ++t) {
+        EXPECT_EQ(results[t], results[0]);
+    }
 }
 
 // ========== List 测试 ==========
@@ -386,6 +997,228 @@ TEST(DictTest, Clear) {
     EXPECT_TRUE(dict.isempty());
 }
 
+TEST(DictTest, Rehash) {
+    Dict<int> dict;
+    for (int i = 0; i < 1000; ++i) {
+        dict.insert(String("https://example.com/path/") + String(std::to_string(i)), i);
+    }
+    for (int i = 0; i < 1000; i += 2) {
+        dict.pop(String("https://example.com/path/") + String(std::to_string(i)), -1);
+    }
+    EXPECT_EQ(dict.size(), 500);
+    for (int i = 0; i < 1000; ++i) {
+        int expected = i % 2 == 0 ? -1 : i;
+        EXPECT_EQ(dict.get(String("https://example.com/path/") + String(std::to_string(i)), -1), expected);
+    }
+}
+
+namespace {
+struct Tracked {
+    static int constructions;
+    static int assignments;
+    int v;
+    Tracked() : v(0) { ++constructions; }
+    Tracked(int x) : v(x) { ++constructions; }
+    Tracked(const Tracked& o) : v(o.v) { ++constructions; }
+    Tracked(Tracked&& o) noexcept : v(o.v) { ++constructions; }
+    auto operator=(const Tracked& o) -> Tracked& { v = o.v; ++assignments; return *this; }
+    auto operator=(Tracked&& o) noexcept -> Tracked& { v = o.v; ++assignments; return *this; }
+};
+int Tracked::constructions = 0;
+int Tracked::assignments = 0;
+} // namespace
+
+TEST(DictTest, Emplace) {
+    Dict<Tracked> dict;
+    Tracked::constructions = 0;
+    Tracked::assignments = 0;
+    auto r1 = dict.try_emplace("a", 1);
+    EXPECT_TRUE(r1.second);
+    EXPECT_EQ(r1.first->value.v, 1);
+    EXPECT_EQ(Tracked::constructions, 1);
+    auto r2 = dict.try_emplace("a", 2);
+    EXPECT_FALSE(r2.second);
+    EXPECT_EQ(dict["a"].v, 1);
+    EXPECT_EQ(Tracked::constructions, 1);
+
+    auto r3 = dict.insert_or_assign("a", Tracked(3));
+    EXPECT_FALSE(r3.second);
+    EXPECT_EQ(Tracked::assignments, 1);
+    auto r4 = dict.emplace("a", 4);
+    EXPECT_FALSE(r4.second);
+    EXPECT_EQ(dict["a"].v, 4);
+    auto r5 = dict.emplace("b", 5);
+    EXPECT_TRUE(r5.second);
+    EXPECT_EQ(dict.size(), 2);
+
+    String key("moved");
+    dict.try_emplace(std::move(key), 6);
+    EXPECT_EQ(dict["moved"].v, 6);
+
+    // 参数引用字典中的值：替换已有的值，以及插入时触发扩容
+    Dict<String> strings;
+    String long_value("a value long enough to live on the heap");
+    strings.emplace("a", long_value);
+    strings.emplace("a", strings["a"]);
+    EXPECT_EQ(strings["a"], long_value);
+    for (int i = 0; strings.size() < 12; ++i) {
+        strings.insert(String("k") + String(std::to_string(i)), String("v"));
+    }
+    strings.emplace("b", strings["a"]);
+    EXPECT_EQ(strings["b"], long_value);
+
+    // try_emplace / insert_or_assign / insert 触发扩容时，参数引用字典中的值
+    // （通过 const 访问，非 const 的 operator[] 自己会先扩容）
+    Dict<String> grow;
+    grow.insert("a", long_value);
+    const Dict<String>& view = grow;
+    for (int i = 0; i < 100; ++i) {
+        String n(std::to_string(i));
+        grow.try_emplace(String("t") + n, view["a"]);
+        grow.insert_or_assign(String("o") + n, view["a"]);
+        grow.insert(String("i") + n, view["a"]);
+    }
+    EXPECT_EQ(grow.size(), 301);
+    for (const auto& entry : grow) {
+        EXPECT_EQ(entry.value, long_value);
+    }
+}
+
+TEST(DictTest, GetManyInsertMany) {
+    Dict<int> dict;
+    std::vector<std::pair<String, int>> items;
+    for (int i = 0; i < 100; ++i) {
+        items.push_back({String("k") + String(std::to_string(i)), i});
+    }
+    dict.insert_many(items);
+    EXPECT_EQ(dict.size(), 100);
+    std::vector<String> keys = {String("k0"), String("k42"), String("missing"), String("k99")};
+    auto out = dict.get_many(keys);
+    ASSERT_EQ(out.size(), 4);
+    ASSERT_NE(out[0], nullptr);
+    EXPECT_EQ(*out[0], 0);
+    EXPECT_EQ(*out[1], 42);
+    EXPECT_EQ(out[2], nullptr);
+    EXPECT_EQ(*out[3], 99);
+
+    // 移动后的字典容量为 0，批量接口和 reserve 仍然可用
+    Dict<int> moved(std::move(dict));
+    EXPECT_EQ(dict.get_many(keys), std::vector<const int*>(4, nullptr));
+    dict.reserve(0);
+    dict.insert_many(items);
+    EXPECT_EQ(*dict.get_many(keys)[1], 42);
+    Dict<int> empty(std::move(moved));
+    moved.insert("x", 1);
+    EXPECT_EQ(moved["x"], 1);
+}
+
+// ========== FrozenDict 测试 ==========
+TEST(FrozenDictTest, Lookup) {
+    Dict<int> dict;
+    for (int i = 0; i < 1000; ++i) {
+        dict.insert(String("key") + String(std::to_string(i)), i);
+    }
+    auto frozen = FrozenDict<int>::from_dict(dict);
+    EXPECT_EQ(frozen.size(), 1000);
+    for (int i = 0; i < 1000; ++i) {
+        auto* value = frozen.find(String("key") + String(std::to_string(i)));
+        ASSERT_NE(value, nullptr);
+        EXPECT_EQ(*value, i);
+    }
+    EXPECT_EQ(frozen.find("missing"), nullptr);
+    EXPECT_EQ(frozen.get("key7", -1), 7);
+    EXPECT_EQ(frozen.get("key1000", -1), -1);
+    EXPECT_TRUE(FrozenDict<int>().empty());
+}
+
+TEST(FrozenDictTest, Bytes) {
+    Dict<double> dict;
+    dict.insert("pi", 3.14);
+    dict.insert("e", 2.71);
+    auto frozen = FrozenDict<double>::from_dict(dict);
+    auto loaded = FrozenDict<double>::from_bytes(frozen.to_bytes());
+    ASSERT_TRUE(loaded.is_ok());
+    EXPECT_DOUBLE_EQ(loaded.value().get("pi", 0.0), 3.14);
+    EXPECT_DOUBLE_EQ(loaded.value().get("e", 0.0), 2.71);
+    EXPECT_TRUE(FrozenDict<double>::from_bytes({1, 2, 3}).is_err());
+    EXPECT_TRUE(FrozenDict<int>::from_bytes(frozen.to_bytes()).is_err());
+}
+
+TEST(FrozenDictTest, CorruptedBytes) {
+    Dict<int> dict;
+    for (int i = 0; i < 200; ++i) {
+        dict.insert(String("k") + String(std::to_string(i)), i);
+    }
+    auto bytes = FrozenDict<int>::from_dict(dict).to_bytes();
+    detail::FrozenHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    // 偏移相加会溢出的文件头被拒绝
+    auto bad = bytes;
+    std::uint64_t huge = UINT64_MAX - 3;
+    std::memcpy(bad.data() + offsetof(detail::FrozenHeader, remap_offset), &huge, 8);
+    EXPECT_TRUE(FrozenDict<int>::from_bytes(bad).is_err());
+    EXPECT_TRUE(FrozenDict<int>::from_bytes(std::vector<std::uint8_t>(bytes.begin(), bytes.end() - 1)).is_err());
+
+    // remap 目标和键范围指向块外：可以加载，但查找不到，也不会越界读取
+    bad = bytes;
+    std::memset(bad.data() + header.remap_offset, 0xff, (header.slot_count - header.count) * 4);
+    for (std::uint64_t slot = 0; slot < header.count; ++slot) {
+        std::uint64_t key_range[2] = {huge, 2};
+        std::memcpy(bad.data() + header.slots_offset + slot * header.slot_size, key_range, 16);
+    }
+    auto loaded = FrozenDict<int>::from_bytes(bad);
+    ASSERT_TRUE(loaded.is_ok());
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_EQ(loaded.value().find(String("k") + String(std::to_string(i))), nullptr);
+    }
+}
+
+// ========== MappedDict 测试 ==========
+TEST(MappedDictTest, SaveAndOpen) {
+    Dict<std::int64_t> dict;
+    for (int i = 0; i < 500; ++i) {
+        dict.insert(String("url/") + String(std::to_string(i)), i * 10);
+    }
+    String path("ks_mapped_dict_test.bin");
+    ASSERT_TRUE(save_frozen(dict, path).is_ok());
+    auto mapped = MappedDict<std::int64_t>::open(path);
+    ASSERT_TRUE(mapped.is_ok());
+    EXPECT_EQ(mapped.value().size(), 500);
+    EXPECT_EQ(mapped.value().get("url/123", -1), 1230);
+    EXPECT_EQ(mapped.value().find("url/500"), nullptr);
+    EXPECT_TRUE(MappedDict<std::int32_t>::open(path).is_err());
+    EXPECT_TRUE(MappedDict<std::int64_t>::open("ks_no_such_file.bin").is_err());
+    std::remove(path.c_str());
+}
+
+TEST(MappedDictTest, CorruptedFile) {
+    Dict<std::int64_t> dict;
+    for (int i = 0; i < 500; ++i) {
+        dict.insert(String("url/") + String(std::to_string(i)), i);
+    }
+    auto bytes = FrozenDict<std::int64_t>::from_dict(dict).to_bytes();
+    detail::FrozenHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    String path("ks_mapped_dict_corrupt.bin");
+
+    // 截断的文件
+    ASSERT_TRUE(detail::write_file(path, bytes.data(), bytes.size() / 2).is_ok());
+    EXPECT_TRUE(MappedDict<std::int64_t>::open(path).is_err());
+
+    // 键范围指向文件之外
+    for (std::uint64_t slot = 0; slot < header.count; ++slot) {
+        std::uint64_t key_offset = header.total_size;
+        std::memcpy(bytes.data() + header.slots_offset + slot * header.slot_size, &key_offset, 8);
+    }
+    ASSERT_TRUE(detail::write_file(path, bytes.data(), bytes.size()).is_ok());
+    auto mapped = MappedDict<std::int64_t>::open(path);
+    ASSERT_TRUE(mapped.is_ok());
+    EXPECT_EQ(mapped.value().find("url/1"), nullptr);
+    EXPECT_EQ(mapped.value().find("url/499"), nullptr);
+    std::remove(path.c_str());
+}
+
 // ========== Color 测试 ==========
 TEST(ColorTest, Colors) {
     // 默认情况下颜色字符串非空
@@ -409,6 +1242,184 @@ TEST(PrintTest, Println) {
     println("number: {}", 42);
     std::string output = testing::internal::GetCapturedStdout();
     EXPECT_EQ(output, "number: 42\n");
+
+    testing::internal::CaptureStdout();
+    println("{} {}", 0.1, 1e100);
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), "0.1 1e+100\n");
+}
+
+TEST(PrintTest, CompiledFormat) {
+    auto fmt = KS_FMT("{} + {} = {} {{ok}}");
+    static_assert(detail::CompiledFormat<decltype(fmt)>::PARSED.args == 3);
+    StringBuilder sb;
+    sb.append_fmt(fmt, 1, String("two"), 3.0);
+    EXPECT_EQ(sb.view(), "1 + two = 3.0 {ok}");
+    EXPECT_EQ(format_to_string(KS_FMT("[{}]{"), -5), String("[-5]{"));
+    EXPECT_EQ(format_to_string(KS_FMT("no args")), String("no args"));
+
+    testing::internal::CaptureStdout();
+    println(KS_FMT("{}-{}"), 'a', 2.5);
+    print(KS_FMT("{}"), "x");
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), "a-2.5\nx");
+}
+
+TEST(PrintTest, FormatSpec) {
+    EXPECT_EQ(format_to_string("{:>6}|{:<4}|{:^7}|{:*^9}", 42, "ab", "mid", 3.5), String("    42|ab  |  mid  |***3.5***"));
+    EXPECT_EQ(format_to_string("{:+d} {:#x} {:#X} {:#b} {:o} {: }", 5, 255, 255, 5, 8, 7), String("+5 0xff 0XFF 0b101 10  7"));
+    EXPECT_EQ(format_to_string("{:05} {:<05} {:#06x} {:c}", -42, 7, 255, 0x65e5), String("-0042 70000 0x00ff 日"));
+    EXPECT_EQ(format_to_string("{:08.3f} {:.0f} {:.2f} {:.1f}", -3.14159, 2.5, 1.005, 0.05), String("-003.142 2 1.00 0.1"));
+    EXPECT_EQ(format_to_string("{:e} {:.2E} {:g} {:.3} {:.1%} {:F}", 12345.678, 0.5, 1e-7, 3.0, 0.256,
+                               std::numeric_limits<double>::infinity()),
+              String("1.234568e+04 5.00E-01 1e-07 3.0 25.6% INF"));
+    // 宽度和截断按码点计
+    EXPECT_EQ(format_to_string("{:.2}|{:>4}|{:·^5}", "héllo", "日本", "x"), String("hé|  日本|··x··"));
+    EXPECT_EQ(format_to_string("{1} {0} {1:>3}", "a", "b"), String("b a   b"));
+
+    EXPECT_EQ(format_to_string(KS_FMT("{:>8.2f}|{:<3}|{:#o}"), 3.14159, 'x', 8), String("    3.14|x  |0o10"));
+    EXPECT_EQ(format_to_string(KS_FMT("{1:x}{0}"), "-", 255), String("ff-"));
+    static_assert(!detail::format_spec_supports<int>(detail::parse_format<3>("{:.2f}").items[0].spec));
+    static_assert(detail::parse_format<5>("{0}{}").error != nullptr);
+}
+
+TEST(PrintTest, FormatTo) {
+    String out("n=");
+    format_to(std::back_inserter(out), "{:>4}|", 42);
+    format_to(std::back_inserter(out), KS_FMT("{:#x}"), 255);
+    EXPECT_EQ(out, String("n=  42|0xff"));
+
+    std::string text;
+    format_to(std::back_inserter(text), "{} {}", 1.5, "x");
+    EXPECT_EQ(text, "1.5 x");
+
+    char buffer[8];
+    char* end = format_to(buffer, KS_FMT("{:03}"), 7);
+    EXPECT_EQ(std::string(buffer, end), "007");
+    auto result = format_to_n(buffer, sizeof(buffer), "{}-{}", 123456, 789);
+    EXPECT_EQ(std::string(buffer, result.out), "123456-7");
+    EXPECT_EQ(result.size, 10u);
+
+    EXPECT_EQ(formatted_size("{:>10}", 1), 10u);
+    EXPECT_EQ(formatted_size(KS_FMT("{}{}"), "abc", -12), 6u);
+
+    // 参数或格式就是目标字符串本身（内联和堆上两种表示）
+    String self("abc");
+    format_to(std::back_inserter(self), "-{}-", self);
+    EXPECT_EQ(self, String("abc-abc-"));
+    String heap(30, 'x');
+    format_to(std::back_inserter(heap), KS_FMT("{}|{}"), StringView(heap), heap.len());
+    EXPECT_EQ(heap, String(30, 'x') + String(30, 'x') + String("|30"));
+    String fmt("<{}>");
+    format_to(std::back_inserter(fmt), fmt, 1);
+    EXPECT_EQ(fmt, String("<{}><1>"));
+}
+
+TEST(PrintTest, Sink) {
+    String path("ks_sink_test.txt");
+    {
+        // 缓冲区很小，频繁写出时各线程的行也不能交错
+        auto sink = Sink::open(path, false, FlushPolicy::Full, 64);
+        ASSERT_TRUE(sink.is_ok());
+        std::vector<std::thread> workers;
+        for (int t = 0; t < 4; ++t) {
+            workers.emplace_back([&sink, t] {
+                for (int i = 0; i < 500; ++i) println(sink.value(), KS_FMT("thread {} line {:>3} end"), t, i);
+            });
+        }
+        for (auto& worker : workers) worker.join();
+        print(sink.value(), "tail {}", 1);
+        EXPECT_TRUE(sink.value().flush().is_ok());
+    }
+    std::ifstream file(path.c_str());
+    std::string line;
+    int count = 0;
+    while (std::getline(file, line)) {
+        if (count == 2000) {
+            EXPECT_EQ(line, "tail 1");
+        } else {
+            EXPECT_EQ(line.size(), std::string("thread 0 line   0 end").size());
+            EXPECT_EQ(line.substr(line.size() - 4), " end");
+        }
+        ++count;
+    }
+    EXPECT_EQ(count, 2001);
+    std::remove(path.c_str());
+    EXPECT_TRUE(Sink::open("ks_no_such_dir/x.txt").is_err());
+}
+
+// ========== Logger 测试 ==========
+TEST(LoggerTest, Log) {
+    String path("ks_logger_test.txt");
+    {
+        auto sink = Sink::open(path);
+        ASSERT_TRUE(sink.is_ok());
+        LoggerOptions options;
+        options.timestamp = false;
+        options.capacity = 256;  // 很小的缓冲区，记录会绕回开头，写满时等待
+        options.overflow = OverflowPolicy::Block;
+        Logger logger(sink.value(), options);
+        EXPECT_FALSE(logger.debug(KS_FMT("hidden {}"), 1));
+        EXPECT_TRUE(logger.warn(KS_FMT("{:>4}|{:.2f}|{}|{}"), 7, 0.125, String("s"), std::string("t")));
+        logger.flush();
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < 2; ++t) {
+            workers.emplace_back([&logger, t] {
+                for (int i = 0; i < 300; ++i) logger.info(KS_FMT("thread {} item {} {}"), t, i, "payload");
+            });
+        }
+        for (auto& worker : workers) worker.join();
+        // 比整个缓冲区还大的记录被丢弃
+        EXPECT_FALSE(logger.error(KS_FMT("{}"), String(1000, 'x')));
+        EXPECT_EQ(logger.dropped(), 1u);
+    }
+    std::ifstream file(path.c_str());
+    std::string line;
+    std::getline(file, line);
+    EXPECT_EQ(line, "WARN    7|0.12|s|t");
+    int info = 0;
+    int dropped = 0;
+    while (std::getline(file, line)) {
+        if (line.rfind("INFO thread ", 0) == 0 && line.substr(line.size() - 8) == " payload") ++info;
+        if (line == "WARN logger: dropped 1 messages") ++dropped;
+    }
+    EXPECT_EQ(info, 600);
+    EXPECT_EQ(dropped, 1);
+    std::remove(path.c_str());
+}
+
+namespace {
+struct LogsWhenPrinted {
+    int id;
+};
+
+Logger* reentrant_logger = nullptr;
+
+auto operator<<(std::ostream& os, const LogsWhenPrinted& value) -> std::ostream& {
+    reentrant_logger->info(KS_FMT("inner {}"), value.id);
+    return os << "outer-" << value.id;
+}
+} // namespace
+
+TEST(LoggerTest, Reentrant) {
+    String path("ks_logger_reentrant.txt");
+    {
+        auto sink = Sink::open(path);
+        ASSERT_TRUE(sink.is_ok());
+        LoggerOptions options;
+        options.timestamp = false;
+        Logger logger(sink.value(), options);
+        reentrant_logger = &logger;
+        // 序列化参数时 operator<< 又写了一条日志，不能覆盖外层正在序列化的记录
+        EXPECT_TRUE(logger.info(KS_FMT("{} {} {}"), 1, LogsWhenPrinted{2}, "end"));
+        reentrant_logger = nullptr;
+    }
+    std::ifstream file(path.c_str());
+    std::string line;
+    std::getline(file, line);
+    EXPECT_EQ(line, "INFO inner 2");
+    std::getline(file, line);
+    EXPECT_EQ(line, "INFO 1 outer-2 end");
+    std::remove(path.c_str());
 }
 
 // ========== BigInt 测试 ==========
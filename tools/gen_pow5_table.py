@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""生成 src/pow5_table.cpp：浮点数解析和格式化使用的 10 的幂的 128 位近似值。
+
+POW5_128：Eisel–Lemire 解析使用，q 属于 [-342, 308]。q >= 0 时取 5^q 规格化后的高 128 位（截断）；
+q < 0 时取 2^b / 5^-q 向上取整后的高 128 位。
+POW10_128：Schubfach 最短表示格式化使用，k 属于 [-292, 326]。取 10^k 规格化到 [2^127, 2^128) 后
+向下取整再加 1（精确值也加 1）。
+10^k 与 5^k 只差 2 的幂，规格化后的有效位相同。每项占两个 uint64，依次为高 64 位和低 64 位。
+
+用法: python3 tools/gen_pow5_table.py [输出路径]，默认写入 src/pow5_table.cpp
+"""
+
+import os
+import sys
+
+SMALLEST_POWER = -342
+LARGEST_POWER = 308
+SHORTEST_SMALLEST_POWER = -292
+SHORTEST_LARGEST_POWER = 326
+
+
+def entries():
+    for q in range(SMALLEST_POWER, 0):
+        power5 = 5 ** -q
+        z = 0
+        while (1 << z) < power5:
+            z += 1
+        if q >= -27:
+            b = z + 127
+            c = 2 ** b // power5 + 1
+        else:
+            b = 2 * z + 2 * 64
+            c = 2 ** b // power5 + 1
+            while c >= (1 << 128):
+                c //= 2
+        yield q, c
+    for q in range(0, LARGEST_POWER + 1):
+        power5 = 5 ** q
+        while power5 < (1 << 127):
+            power5 *= 2
+        while power5 >= (1 << 128):
+            power5 //= 2
+        yield q, power5
+
+
+def shortest_entries():
+    for k in range(SHORTEST_SMALLEST_POWER, SHORTEST_LARGEST_POWER + 1):
+        num, den = (10 ** k, 1) if k >= 0 else (1, 10 ** -k)
+        # 取 shift 使 num * 2^shift / den 落在 [2^127, 2^128)
+        shift = 127 - (num.bit_length() - den.bit_length())
+        while (num << max(shift, 0)) >= (den << max(-shift, 0)) << 128:
+            shift -= 1
+        while (num << max(shift, 0)) < (den << max(-shift, 0)) << 127:
+            shift += 1
+        if shift >= 0:
+            g = (num << shift) // den + 1
+        else:
+            g = num // (den << -shift) + 1
+        yield k, g
+
+
+def table(name, items, label):
+    lines = [f"    0x{c >> 64:016x}, 0x{c & ((1 << 64) - 1):016x},  // {label}^{q}" for q, c in items]
+    body = "\n".join(lines)
+    return f"""extern const std::uint64_t {name}[];
+
+const std::uint64_t {name}[] = {{
+{body}
+}};
+"""
+
+
+def main():
+    out_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+        os.path.dirname(os.path.abspath(__file__)), "..", "src", "pow5_table.cpp")
+    with open(out_path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(f"""// 由 tools/gen_pow5_table.py 生成，请勿手动修改
+
+#include <cstdint>
+
+namespace ks {{
+namespace detail {{
+
+{table("POW5_128", entries(), "5")}
+{table("POW10_128", shortest_entries(), "10")}
+}} // namespace detail
+}} // namespace ks
+""")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""生成 src/unicode_data.cpp：ks::String 大小写转换和字符分类使用的 Unicode 属性表。
+
+数据取自 Python 自带的 unicodedata 数据库（版本与运行脚本的 Python 一致），
+映射规则与 Python 的 str.lower / upper / title / isalpha 等一致（包括一对多的完整大小写映射）。
+ASCII 部分按 C locale 的规则处理，与 ascii.cpp 的向量化快速路径保持一致。
+
+用法: python3 tools/gen_unicode_data.py [输出路径]，默认写入 src/unicode_data.cpp
+"""
+
+import os
+import sys
+import unicodedata
+
+# 必须与 src/unicode.hpp 中的 UNICODE_BLOCK_SHIFT 一致
+BLOCK_SHIFT = 8
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+MAX_CODE_POINT = 0x110000
+
+# 必须与 src/unicode.hpp 中的 CharFlag 一致
+ALPHA = 1 << 0
+DIGIT = 1 << 1
+NUMERIC = 1 << 2
+SPACE = 1 << 3
+LOWER = 1 << 4
+UPPER = 1 << 5
+TITLE = 1 << 6
+CASED = 1 << 7
+CASE_IGNORABLE = 1 << 8
+
+# Word_Break 为 MidLetter、MidNumLet、Single_Quote 的字符，属于 Case_Ignorable（Unicode 3.13 节）
+WORD_BREAK_MID = {
+    0x0027, 0x002E, 0x003A, 0x00B7, 0x0387, 0x055F, 0x05F4, 0x2018, 0x2019,
+    0x2024, 0x2027, 0xFE13, 0xFE52, 0xFE55, 0xFF07, 0xFF0E, 0xFF1A,
+}
+
+
+def char_flags(cp):
+    c = chr(cp)
+    category = unicodedata.category(c)
+    flags = 0
+    if c.isalpha():
+        flags |= ALPHA
+    if c.isdigit():
+        flags |= DIGIT
+    if c.isnumeric():
+        flags |= NUMERIC
+    if c.isspace():
+        flags |= SPACE
+    if c.islower():
+        flags |= LOWER
+    if c.isupper():
+        flags |= UPPER
+    if category == "Lt":
+        flags |= TITLE
+    if flags & (LOWER | UPPER | TITLE):
+        flags |= CASED
+    if category in ("Mn", "Me", "Cf", "Lm", "Sk") or cp in WORD_BREAK_MID:
+        flags |= CASE_IGNORABLE
+    if cp < 0x80 and flags & SPACE and not (cp == 0x20 or 0x09 <= cp <= 0x0D):
+        # C locale 的 isspace 不包括 \x1c-\x1f
+        flags &= ~SPACE
+    return flags
+
+
+def padded(text):
+    assert len(text) <= 3, text
+    return [ord(ch) for ch in text] + [0] * (3 - len(text))
+
+
+def build():
+    records = {}
+    specials = []
+    index = []
+    for cp in range(MAX_CODE_POINT):
+        c = chr(cp)
+        if 0xD800 <= cp <= 0xDFFF:
+            lower = upper = title = c
+        else:
+            lower, upper, title = c.lower(), c.upper(), c.title()
+        flags = char_flags(cp)
+        if len(lower) > 1 or len(upper) > 1 or len(title) > 1:
+            specials.append((cp, lower, upper, title))
+            key = (flags, len(specials), 0, 0, 0)
+        else:
+            key = (flags, 0, ord(lower) - cp, ord(upper) - cp, ord(title) - cp)
+        index.append(records.setdefault(key, len(records)))
+
+    blocks = {}
+    stage1 = []
+    for start in range(0, MAX_CODE_POINT, BLOCK_SIZE):
+        block = tuple(index[start:start + BLOCK_SIZE])
+        stage1.append(blocks.setdefault(block, len(blocks)))
+    assert len(blocks) <= 256, "stage1 no longer fits in uint8"
+    assert len(records) <= 65536
+    return records, specials, stage1, blocks
+
+
+def rows(values, per_line, width):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + " ".join(f"{v:>{width}}," for v in values[i:i + per_line]))
+    return "\n".join(lines)
+
+
+def main():
+    out_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+        os.path.dirname(os.path.abspath(__file__)), "..", "src", "unicode_data.cpp")
+    records, specials, stage1, blocks = build()
+
+    record_lines = []
+    for (flags, special, lower, upper, title), _ in sorted(records.items(), key=lambda item: item[1]):
+        record_lines.append(f"    {{{lower}, {upper}, {title}, 0x{flags:03X}, {special}}},")
+
+    special_lines = []
+    for cp, lower, upper, title in specials:
+        parts = ", ".join("{" + ", ".join(f"0x{v:X}" for v in padded(text)) + "}" for text in (lower, upper, title))
+        special_lines.append(f"    {{{parts}}},  // U+{cp:04X}")
+
+    stage2 = [value for block, _ in sorted(blocks.items(), key=lambda item: item[1]) for value in block]
+
+    with open(out_path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(f"""// 由 tools/gen_unicode_data.py 生成，请勿手动修改。Unicode {unicodedata.unidata_version}
+// {len(records)} 种属性记录，{len(blocks)} 个 {BLOCK_SIZE} 码点的块，{len(specials)} 个一对多映射
+
+#include "unicode.hpp"
+
+namespace ks {{
+namespace detail {{
+
+const CharRecord CHAR_RECORDS[] = {{
+{chr(10).join(record_lines)}
+}};
+
+const SpecialCasing SPECIAL_CASING[] = {{
+    {{{{0, 0, 0}}, {{0, 0, 0}}, {{0, 0, 0}}}},
+{chr(10).join(special_lines)}
+}};
+
+const std::uint8_t CHAR_STAGE1[] = {{
+{rows(stage1, 16, 3)}
+}};
+
+const std::uint16_t CHAR_STAGE2[] = {{
+{rows(stage2, 16, 3)}
+}};
+
+}} // namespace detail
+}} // namespace ks
+""")
+
+
+if __name__ == "__main__":
+    main()